@@ -85,6 +85,9 @@ if(NOT CONAN_OPENSTUDIO_ALREADY_RUN)
 
   # TODO:  list(APPEND CONAN_OPTIONS "fmt:header_only=True")
 
+  # LocalBCL uses an FTS5 table (trigram tokenizer) to search components and measures
+  list(APPEND CONAN_OPTIONS "sqlite3:enable_fts5=True")
+
   if(APPLE)
     # #4120 - global is the 'default' visibility in gcc/clang
     list(APPEND CONAN_OPTIONS "boost:visibility=global")
@@ -0,0 +1,117 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2023, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "AirflowFixture.hpp"
+
+#include "../contam/SimFile.hpp"
+
+#include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/core/PathHelpers.hpp"
+
+using namespace openstudio;
+
+namespace {
+
+// Writes a small simread style result set: three time steps, two paths and three nodes (including ambient)
+openstudio::path writeSimReadResults(const std::string& name) {
+  openstudio::path dir = openstudio::tempDir() / openstudio::toPath("SimFile_GTest");
+  openstudio::filesystem::create_directories(dir);
+  openstudio::path simPath = dir / openstudio::toPath(name + ".sim");
+
+  // CRLF line endings and a trailing newline, as simread output copied around on Windows looks
+  openstudio::filesystem::ofstream lfr(dir / openstudio::toPath(name + ".lfr"));
+  lfr << "day\ttime\tP#\tdP\tF0\tF1\r\n";
+  const char* times[] = {"00:00:00", "01:00:00", "02:00:00"};
+  for (int step = 0; step < 3; ++step) {
+    lfr << "1/1\t" << times[step] << "\t1\t" << 1.0 + 2 * step << "\t" << 0.1 * (2 * step + 1) << "\t0\r\n";
+    lfr << "1/1\t" << times[step] << "\t2\t" << -2.0 - 2 * step << "\t0\t" << -0.2 * (step + 1) << "\r\n";
+  }
+  lfr.close();
+
+  openstudio::filesystem::ofstream nfr(dir / openstudio::toPath(name + ".nfr"));
+  nfr << "day\ttime\tZ#\tT\tP\tD\n";
+  for (int step = 0; step < 3; ++step) {
+    nfr << "1/1\t" << times[step] << "\t0\t" << 273.15 + step << "\t0\t-\n";
+    nfr << "1/1\t" << times[step] << "\t1\t" << 293.15 + step << "\t" << 10.0 * step << "\t1.2\n";
+    nfr << "1/1\t" << times[step] << "\t2\t" << 294.15 + step << "\t" << 20.0 * step << "\t1.1\n";
+  }
+  nfr.close();
+
+  return simPath;
+}
+
+}  // namespace
+
+TEST_F(AirflowFixture, SimFile_ReadResults) {
+  openstudio::contam::SimFile sim(writeSimReadResults("all"));
+
+  ASSERT_EQ(3u, sim.fileDateTimes().size());
+  EXPECT_EQ(2u, sim.dateTimes().size());
+
+  ASSERT_EQ(std::vector<int>({1, 2}), sim.pathNrs());
+  ASSERT_EQ(2u, sim.dP().size());
+  EXPECT_EQ(std::vector<double>({1.0, 3.0, 5.0}), sim.dP()[0]);
+  EXPECT_EQ(std::vector<double>({-0.2, -0.4, -0.6}), sim.F1()[1]);
+
+  boost::optional<TimeSeries> flow = sim.pathFlow(2);
+  ASSERT_TRUE(flow);
+  ASSERT_EQ(2u, flow->values().size());
+  EXPECT_DOUBLE_EQ(-0.3, flow->values()[0]);
+  EXPECT_DOUBLE_EQ(-0.5, flow->values()[1]);
+  EXPECT_FALSE(sim.pathFlow(3));
+
+  // The ambient node has no density, which reads as zero
+  ASSERT_EQ(std::vector<int>({0, 1, 2}), sim.nodeNrs());
+  EXPECT_EQ(std::vector<double>({0.0, 0.0, 0.0}), sim.D()[0]);
+  boost::optional<TimeSeries> temperature = sim.nodeTemperature(2);
+  ASSERT_TRUE(temperature);
+  EXPECT_DOUBLE_EQ(294.65, temperature->values()[0]);
+  EXPECT_DOUBLE_EQ(295.65, temperature->values()[1]);
+}
+
+TEST_F(AirflowFixture, SimFile_ReadSelected) {
+  openstudio::contam::SimFile sim(writeSimReadResults("selected"), {2}, {1});
+
+  ASSERT_EQ(3u, sim.fileDateTimes().size());
+
+  EXPECT_EQ(std::vector<int>({2}), sim.pathNrs());
+  EXPECT_FALSE(sim.pathFlow(1));
+  boost::optional<TimeSeries> deltaP = sim.pathDeltaP(2);
+  ASSERT_TRUE(deltaP);
+  EXPECT_DOUBLE_EQ(-3.0, deltaP->values()[0]);
+  EXPECT_DOUBLE_EQ(-5.0, deltaP->values()[1]);
+
+  EXPECT_EQ(std::vector<int>({1}), sim.nodeNrs());
+  EXPECT_FALSE(sim.nodeTemperature(2));
+  boost::optional<TimeSeries> pressure = sim.nodePressure(1);
+  ASSERT_TRUE(pressure);
+  EXPECT_DOUBLE_EQ(5.0, pressure->values()[0]);
+  EXPECT_DOUBLE_EQ(15.0, pressure->values()[1]);
+}
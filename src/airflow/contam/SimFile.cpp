@@ -32,6 +32,14 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/classification.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+
 namespace openstudio {
 namespace contam {
 
@@ -44,20 +52,130 @@ namespace contam {
     return -1;
   }
 
-  SimFile::SimFile(openstudio::path path) {
+  namespace {
+
+    constexpr size_t maxResultColumns = 8;
+
+    // Splits a tab separated line into views on the line, returns the number of fields found (which may exceed the array size)
+    size_t splitFields(std::string_view line, std::array<std::string_view, maxResultColumns>& fields) {
+      size_t count = 0;
+      size_t start = 0;
+      while (true) {
+        size_t end = line.find('\t', start);
+        if (count < fields.size()) {
+          fields[count] = line.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start);
+        }
+        ++count;
+        if (end == std::string_view::npos) {
+          break;
+        }
+        start = end + 1;
+      }
+      return count;
+    }
+
+    // Same acceptance as std::stoi, without the exception, the parse may not run into the next field
+    bool parseInt(std::string_view field, int& value) {
+      if (field.empty()) {
+        return false;
+      }
+      char* end = nullptr;
+      errno = 0;
+      long result = std::strtol(field.data(), &end, 10);
+      if ((end == field.data()) || (end > field.data() + field.size()) || (errno == ERANGE) || (result > std::numeric_limits<int>::max())
+          || (result < std::numeric_limits<int>::min())) {
+        return false;
+      }
+      value = static_cast<int>(result);
+      return true;
+    }
+
+    // Same acceptance as std::stod, without the exception, the parse may not run into the next field
+    bool parseDouble(std::string_view field, double& value) {
+      if (field.empty()) {
+        return false;
+      }
+      char* end = nullptr;
+      errno = 0;
+      double result = std::strtod(field.data(), &end);
+      if ((end == field.data()) || (end > field.data() + field.size()) || (errno == ERANGE)) {
+        return false;
+      }
+      value = result;
+      return true;
+    }
+
+    // Maps CONTAM path/node numbers to result columns in order of first appearance. Every time step lists
+    // the same numbers in the same order, so the next column is tried before falling back to the hash lookup
+    class ColumnIndex
+    {
+     public:
+      explicit ColumnIndex(std::vector<int>& nrs) : m_nrs(nrs) {}
+
+      // Returns the column for nr and whether it was just created
+      std::pair<size_t, bool> column(int nr) {
+        if ((m_next < m_nrs.size()) && (m_nrs[m_next] == nr)) {
+          return {m_next++, false};
+        }
+        auto it = m_lookup.find(nr);
+        if (it != m_lookup.end()) {
+          m_next = it->second + 1;
+          return {it->second, false};
+        }
+        size_t index = m_nrs.size();
+        m_nrs.push_back(nr);
+        m_lookup[nr] = index;
+        m_next = index + 1;
+        return {index, true};
+      }
+
+     private:
+      std::vector<int>& m_nrs;
+      std::unordered_map<int, size_t> m_lookup;
+      size_t m_next = 0;
+    };
+
+    bool isSelected(const std::vector<int>& sortedSelection, int nr) {
+      return sortedSelection.empty() || std::binary_search(sortedSelection.begin(), sortedSelection.end(), nr);
+    }
+
+    void stripCarriageReturn(std::string& line) {
+      if (!line.empty() && (line.back() == '\r')) {
+        line.pop_back();
+      }
+    }
+
+    // Estimates the number of time steps in a file from the number of bytes used by the first one
+    size_t estimateTimeSteps(uintmax_t fileSize, uintmax_t bytesPerStep) {
+      if (bytesPerStep == 0) {
+        return 0;
+      }
+      return static_cast<size_t>(fileSize / bytesPerStep) + 1;
+    }
+
+  }  // namespace
+
+  SimFile::SimFile(openstudio::path path) : SimFile(std::move(path), std::vector<int>(), std::vector<int>()) {}
+
+  SimFile::SimFile(openstudio::path path, const std::vector<int>& pathNrs, const std::vector<int>& nodeNrs) {
     m_hasLfr = false;
     m_hasNfr = false;
     m_hasNcr = false;
+    std::vector<int> sortedPathNrs(pathNrs);
+    std::sort(sortedPathNrs.begin(), sortedPathNrs.end());
+    std::vector<int> sortedNodeNrs(nodeNrs);
+    std::sort(sortedNodeNrs.begin(), sortedNodeNrs.end());
     // For now, we need to cheat and assume that the .lfr etc. actually exist
     // This means that simread has to have been run for this to work
     openstudio::path lfrPath = path.replace_extension(openstudio::toPath("lfr").string());
-    m_hasLfr = readLfr(openstudio::toString(lfrPath));
+    m_hasLfr = readLfr(openstudio::toString(lfrPath), sortedPathNrs);
     openstudio::path nfrPath = path.replace_extension(openstudio::toPath("nfr").string());
-    m_hasNfr = readNfr(openstudio::toString(nfrPath));
+    m_hasNfr = readNfr(openstudio::toString(nfrPath), sortedNodeNrs);
   }
 
   bool SimFile::computeDateTimes(const std::vector<std::string>& day, const std::vector<std::string>& time) {
     int n = std::min((int)day.size(), (int)time.size());
+    m_dateTimes.reserve(m_dateTimes.size() + n);
     for (int i = 0; i < n; i++) {
       std::vector<std::string> split;
       boost::split(split, day[i], boost::is_any_of("/"));
@@ -84,112 +202,109 @@ namespace contam {
   }
 
   void SimFile::clearLfr() {
+    m_pathNr.clear();
     m_dP.clear();
     m_F0.clear();
     m_F1.clear();
   }
 
-  bool SimFile::readLfr(const std::string& fileName) {
+  bool SimFile::readLfr(const std::string& fileName, const std::vector<int>& pathNrs) {
     clearLfr();
     std::vector<std::string> day;
     std::vector<std::string> time;
-    openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
+    openstudio::path filePath = openstudio::toPath(fileName);
+    openstudio::filesystem::ifstream file(filePath);
     if (!file.is_open()) {
       LOG(Error, "Failed to open LFR file '" << fileName << "'");
       return false;
     }
-    std::map<int, int> nrMap;
+    uintmax_t fileSize = openstudio::filesystem::file_size(filePath);
     // Read the header
-    std::string headerstr;
-    std::getline(file, headerstr);
-    std::string header = headerstr;
-    if (header.empty()) {
+    std::string line;
+    std::getline(file, line);
+    stripCarriageReturn(line);
+    if (line.empty()) {
       LOG(Error, "No data in LFR file '" << fileName << "'");
       return false;
     }
-    std::vector<std::string> row;
-    boost::split(row, header, boost::is_any_of("\t"));
-    unsigned ncols = 6;
-    if (row.size() != ncols) {
-      LOG(Error, "LFR file has " << row.size() << " columns, not the expected " << ncols);
+    std::array<std::string_view, maxResultColumns> row;
+    size_t ncols = 6;
+    size_t nfields = splitFields(line, row);
+    if (nfields != ncols) {
+      LOG(Error, "LFR file has " << nfields << " columns, not the expected " << ncols);
       return false;
     }
-    // Read the data
-    while (file.good()) {
-      std::string linestr;
-      std::getline(file, linestr);
-      std::string line = linestr;
-      std::vector<std::string> row;
-      boost::split(row, line, boost::is_any_of("\t"));
-      if (row.size() != ncols) {
+    uintmax_t bytesRead = line.size() + 1;
+    uintmax_t headerBytes = bytesRead;
+    ColumnIndex columns(m_pathNr);
+    // Read the data, values go straight into their path column
+    while (std::getline(file, line)) {
+      bytesRead += line.size() + 1;
+      stripCarriageReturn(line);
+      if (line.empty()) {
+        continue;
+      }
+      nfields = splitFields(line, row);
+      if (nfields != ncols) {
         clearLfr();
-        LOG(Error, "LFR data line has " << row.size() << " columns, not the expected " << ncols);
+        LOG(Error, "LFR data line has " << nfields << " columns, not the expected " << ncols);
         return false;
       }
-      if (!time.empty()) {
-        if (time[time.size() - 1] != row[1]) {
-          day.push_back(row[0]);
-          time.push_back(row[1]);
+      if (time.empty() || (time.back() != row[1])) {
+        if (time.size() == 1) {
+          // The first time step is complete, size the columns for the rest of the file
+          size_t nsteps = estimateTimeSteps(fileSize - headerBytes, bytesRead - headerBytes - (line.size() + 1));
+          day.reserve(nsteps);
+          time.reserve(nsteps);
+          for (size_t i = 0; i < m_dP.size(); ++i) {
+            m_dP[i].reserve(nsteps);
+            m_F0[i].reserve(nsteps);
+            m_F1[i].reserve(nsteps);
+          }
         }
-      } else {
-        day.push_back(row[0]);
-        time.push_back(row[1]);
+        day.emplace_back(row[0]);
+        time.emplace_back(row[1]);
       }
 
       int nr = 0;
-      try {
-        nr = std::stoi(row[2]);
-      } catch (const std::exception&) {
+      if (!parseInt(row[2], nr)) {
         clearLfr();
         LOG(Error, "Invalid link number '" << row[2] << "'");
         return false;
       }
-      if (nrMap.find(nr) == nrMap.end()) {
-        int sz = nrMap.size();
-        nrMap[nr] = sz;
-        m_dP.resize(sz + 1);
-        m_F0.resize(sz + 1);
-        m_F1.resize(sz + 1);
+      if (!isSelected(pathNrs, nr)) {
+        continue;
+      }
+      auto [index, created] = columns.column(nr);
+      if (created) {
+        m_dP.resize(index + 1);
+        m_F0.resize(index + 1);
+        m_F1.resize(index + 1);
       }
       double dP = 0;
-      try {
-        dP = std::stod(row[3]);
-      } catch (const std::exception&) {
+      if (!parseDouble(row[3], dP)) {
         clearLfr();
         LOG(Error, "Invalid pressure difference '" << row[3] << "'");
         return false;
       }
 
       double F0 = 0;
-      try {
-        F0 = std::stod(row[4]);
-      } catch (const std::exception&) {
+      if (!parseDouble(row[4], F0)) {
         clearLfr();
         LOG(Error, "Invalid flow 0 '" << row[4] << "'");
         return false;
       }
 
       double F1 = 0;
-      try {
-        F1 = std::stod(row[5]);
-      } catch (const std::exception&) {
+      if (!parseDouble(row[5], F1)) {
         clearLfr();
         LOG(Error, "Invalid flow 1 '" << row[5] << "'");
         return false;
       }
 
-      m_dP[nrMap[nr]].push_back(dP);
-      m_F0[nrMap[nr]].push_back(F0);
-      m_F1[nrMap[nr]].push_back(F1);
-    }
-    // Unwind the zone number map;
-    std::vector<int> keys;
-    for (const auto& pair : nrMap) {
-      keys.push_back(pair.first);
-    }
-    m_pathNr.resize(keys.size());
-    for (std::vector<int>::size_type i = 0; i < keys.size(); ++i) {
-      m_pathNr[nrMap[keys[i]]] = keys[i];
+      m_dP[index].push_back(dP);
+      m_F0[index].push_back(F0);
+      m_F1[index].push_back(F1);
     }
     file.close();
     // Compute the required date/time objects - this needs to be moved elsewhere if the NCR and NFR are also read
@@ -203,97 +318,101 @@ namespace contam {
   }
 
   void SimFile::clearNfr() {
+    m_nodeNr.clear();
     m_T.clear();
     m_P.clear();
     m_D.clear();
   }
 
-  bool SimFile::readNfr(const std::string& fileName) {
+  bool SimFile::readNfr(const std::string& fileName, const std::vector<int>& nodeNrs) {
     clearNfr();
     std::vector<std::string> day;
     std::vector<std::string> time;
-    openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-    if (file.is_open()) {
+    openstudio::path filePath = openstudio::toPath(fileName);
+    openstudio::filesystem::ifstream file(filePath);
+    if (!file.is_open()) {
       LOG(Error, "Failed to open NFR file '" << fileName << "'");
       return false;
     }
-
-    std::map<int, int> nrMap;
+    uintmax_t fileSize = openstudio::filesystem::file_size(filePath);
     // Read the header
-    std::string headerstr;
-    std::getline(file, headerstr);
-    std::string header = headerstr;
-    if (header.empty()) {
-      LOG(Error, "No data in LFR file '" << fileName << "'");
+    std::string line;
+    std::getline(file, line);
+    stripCarriageReturn(line);
+    if (line.empty()) {
+      LOG(Error, "No data in NFR file '" << fileName << "'");
       return false;
     }
-    std::vector<std::string> row;
-    boost::split(row, header, boost::is_any_of("\t"));
-    unsigned ncols = 6;
-    if (row.size() != ncols && row.size() != ncols + 2) {
-      LOG(Error, "NFR file has " << row.size() << " columns, not the expected " << ncols);
+    std::array<std::string_view, maxResultColumns> row;
+    size_t ncols = 6;
+    size_t nfields = splitFields(line, row);
+    if (nfields != ncols && nfields != ncols + 2) {
+      LOG(Error, "NFR file has " << nfields << " columns, not the expected " << ncols);
       return false;
     }
-    // Read the data
-    while (file.good()) {
-      std::string linestr;
-      std::getline(file, linestr);
-      std::string line = linestr;
-
-      std::vector<std::string> row;
-      boost::split(row, line, boost::is_any_of("\t"));
-      if (row.size() != ncols && row.size() != ncols + 2) {
+    uintmax_t bytesRead = line.size() + 1;
+    uintmax_t headerBytes = bytesRead;
+    ColumnIndex columns(m_nodeNr);
+    // Read the data, values go straight into their node column
+    while (std::getline(file, line)) {
+      bytesRead += line.size() + 1;
+      stripCarriageReturn(line);
+      if (line.empty()) {
+        continue;
+      }
+      nfields = splitFields(line, row);
+      if (nfields != ncols && nfields != ncols + 2) {
         clearNfr();
-        LOG(Error, "NFR data line has " << row.size() << " columns, not the expected " << ncols);
+        LOG(Error, "NFR data line has " << nfields << " columns, not the expected " << ncols);
         return false;
       }
-      if (!time.empty()) {
-        if (time[time.size() - 1] != row[1]) {
-          day.push_back(row[0]);
-          time.push_back(row[1]);
+      if (time.empty() || (time.back() != row[1])) {
+        if (time.size() == 1) {
+          // The first time step is complete, size the columns for the rest of the file
+          size_t nsteps = estimateTimeSteps(fileSize - headerBytes, bytesRead - headerBytes - (line.size() + 1));
+          day.reserve(nsteps);
+          time.reserve(nsteps);
+          for (size_t i = 0; i < m_T.size(); ++i) {
+            m_T[i].reserve(nsteps);
+            m_P[i].reserve(nsteps);
+            m_D[i].reserve(nsteps);
+          }
         }
-      } else {
-        day.push_back(row[0]);
-        time.push_back(row[1]);
+        day.emplace_back(row[0]);
+        time.emplace_back(row[1]);
       }
 
       int nr = 0;
-      try {
-        nr = std::stoi(row[2]);
-      } catch (const std::exception&) {
+      if (!parseInt(row[2], nr)) {
         clearNfr();
         LOG(Error, "Invalid node number '" << row[2] << "'");
         return false;
       }
-      if (nrMap.find(nr) == nrMap.end()) {
-        int sz = nrMap.size();
-        nrMap[nr] = sz;
-        m_T.resize(sz + 1);
-        m_P.resize(sz + 1);
-        m_D.resize(sz + 1);
+      if (!isSelected(nodeNrs, nr)) {
+        continue;
+      }
+      auto [index, created] = columns.column(nr);
+      if (created) {
+        m_T.resize(index + 1);
+        m_P.resize(index + 1);
+        m_D.resize(index + 1);
       }
       double T = 0;
-      try {
-        T = std::stod(row[3]);
-      } catch (const std::exception&) {
+      if (!parseDouble(row[3], T)) {
         clearNfr();
         LOG(Error, "Invalid temperature '" << row[3] << "'");
         return false;
       }
 
       double P = 0;
-      try {
-        P = std::stod(row[4]);
-      } catch (const std::exception&) {
+      if (!parseDouble(row[4], P)) {
         clearNfr();
         LOG(Error, "Invalid pressure '" << row[4] << "'");
         return false;
       }
 
       double D = 0;
-      try {
-        D = std::stod(row[5]);
-      } catch (const std::exception&) {
+      if (!parseDouble(row[5], D)) {
         if (nr == 0) {
           D = 0.0;
         } else {
@@ -302,25 +421,16 @@ namespace contam {
           return false;
         }
       }
-      m_T[nrMap[nr]].push_back(T);
-      m_P[nrMap[nr]].push_back(P);
-      m_D[nrMap[nr]].push_back(D);
-    }
-    // Unwind the zone number map;
-    std::vector<int> keys;
-    for (const auto& pair : nrMap) {
-      keys.push_back(pair.first);
-    }
-    m_nodeNr.resize(keys.size());
-    for (std::vector<int>::size_type i = 0; i < keys.size(); ++i) {
-      m_nodeNr[nrMap[keys[i]]] = keys[i];
+      m_T[index].push_back(T);
+      m_P[index].push_back(P);
+      m_D[index].push_back(D);
     }
     file.close();
     // Something should probably be done here to make sure that the times here match up with what we
     // already have. For now, if nothing is known about the dates, then try to compute it
     if (m_dateTimes.empty()) {
       if (!computeDateTimes(day, time)) {
-        clearLfr();
+        clearNfr();
         m_dateTimes.clear();
         LOG(Error, "Failed to compute date and time objects from NFR input");
         return false;
@@ -329,19 +439,19 @@ namespace contam {
     return true;
   }
 
-  static openstudio::TimeSeries convertData(std::vector<openstudio::DateTime> inputDateTimes, std::vector<double> inputValues, std::string units) {
+  static openstudio::TimeSeries convertData(const std::vector<openstudio::DateTime>& inputDateTimes, const std::vector<double>& inputValues,
+                                            const std::string& units) {
     // Use a per-interval trapezoidal approximation to convert the CONTAM point data into E+ interval data
-    std::vector<openstudio::DateTime> dateTimes;
-    std::vector<double> values;
-    if (inputDateTimes.size() == 1)  // Account for steady simulation results
+    if (inputDateTimes.size() <= 1)  // Account for steady simulation results
     {
       return openstudio::TimeSeries(inputDateTimes, createVector(inputValues), units);
     }
+    std::vector<openstudio::DateTime> dateTimes(inputDateTimes.begin() + 1, inputDateTimes.end());
+    Vector values(dateTimes.size());
     for (unsigned i = 1; i < inputDateTimes.size(); i++) {
-      dateTimes.push_back(inputDateTimes[i]);
-      values.push_back(0.5 * (inputValues[i - 1] + inputValues[i]));
+      values[i - 1] = 0.5 * (inputValues[i - 1] + inputValues[i]);
     }
-    return openstudio::TimeSeries(dateTimes, createVector(values), units);
+    return openstudio::TimeSeries(dateTimes, values, units);
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::pathDeltaP(int nr) const {
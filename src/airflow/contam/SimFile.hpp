@@ -44,26 +44,37 @@ namespace contam {
   {
    public:
     explicit SimFile(openstudio::path path);
+    /** Reads only the listed paths and nodes, an empty list reads everything of that kind.
+   *  Use this on large multizone results when only a few flows or nodes are of interest. */
+    SimFile(openstudio::path path, const std::vector<int>& pathNrs, const std::vector<int>& nodeNrs);
 
-    // These are provided for advanced use
-    std::vector<std::vector<double>> dP() const {
+    // These are provided for advanced use, one column of values per path or node
+    const std::vector<std::vector<double>>& dP() const {
       return m_dP;
     }
-    std::vector<std::vector<double>> F0() const {
+    const std::vector<std::vector<double>>& F0() const {
       return m_F0;
     }
-    std::vector<std::vector<double>> F1() const {
+    const std::vector<std::vector<double>>& F1() const {
       return m_F1;
     }
-    std::vector<std::vector<double>> T() const {
+    const std::vector<std::vector<double>>& T() const {
       return m_T;
     }
-    std::vector<std::vector<double>> P() const {
+    const std::vector<std::vector<double>>& P() const {
       return m_P;
     }
-    std::vector<std::vector<double>> D() const {
+    const std::vector<std::vector<double>>& D() const {
       return m_D;
     }
+    /** Returns the CONTAM path numbers, in the same order as the dP, F0 and F1 columns */
+    const std::vector<int>& pathNrs() const {
+      return m_pathNr;
+    }
+    /** Returns the CONTAM node numbers, in the same order as the T, P and D columns */
+    const std::vector<int>& nodeNrs() const {
+      return m_nodeNr;
+    }
 
     // Most use should be confined to these
     boost::optional<openstudio::TimeSeries> pathDeltaP(int nr) const;
@@ -86,9 +97,9 @@ namespace contam {
 
    private:
     void clearLfr();
-    bool readLfr(const std::string& fileName);
+    bool readLfr(const std::string& fileName, const std::vector<int>& pathNrs);
     void clearNfr();
-    bool readNfr(const std::string& fileName);
+    bool readNfr(const std::string& fileName, const std::vector<int>& nodeNrs);
     bool computeDateTimes(const std::vector<std::string>& day, const std::vector<std::string>& time);
 
     std::vector<int> m_pathNr;  // the CONTAM path index
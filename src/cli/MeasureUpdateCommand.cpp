@@ -32,6 +32,7 @@
 #include "MeasureUpdateCommand.hpp"
 #include "../utilities/core/Filesystem.hpp"
 #include "../utilities/bcl/BCLMeasure.hpp"
+#include "../utilities/bcl/BCLXML.hpp"
 #include "../scriptengine/ScriptEngine.hpp"
 #include "../measure/OSMeasure.hpp"
 #include "../measure/ModelMeasure.hpp"
@@ -42,9 +43,12 @@
 #include "../measure/OSRunner.hpp"
 #include "../measure/OSMeasureInfoGetter.hpp"
 #include "../utilities/idf/Workspace.hpp"
+#include "../utilities/core/ParallelFor.hpp"
 #include <utilities/idd/IddEnums.hxx>
+#include <OpenStudio.hxx>
 
 #include <fmt/format.h>
+#include <json/json.h>
 #include <boost/optional.hpp>
 #include <memory>
 #include <stdexcept>
@@ -91,8 +95,54 @@ namespace cli {
     measureCommand->callback([opt, &rubyEngine, &pythonEngine] { MeasureUpdateOptions::execute(*opt, rubyEngine, pythonEngine); });
   }
 
-  boost::optional<BCLMeasure> getAndUpdateMeasure(const openstudio::path& directoryPath, ScriptEngineInstance& rubyEngine,
-                                                  ScriptEngineInstance& pythonEngine) {
+  // Kept in the --update_all directory, maps each measure subdirectory to the size and mtime of its files after its last update
+  constexpr auto measureUpdateCacheFileName = ".openstudio_measure_update_cache.json";
+
+  /** The update of an unchanged measure still depends on the OpenStudio version and on the measure.xml schema it writes,
+   *  so a cache written by another version is ignored */
+  Json::Value measureUpdateCacheVersion() {
+    Json::Value result(Json::objectValue);
+    result["openstudio_version"] = openStudioLongVersion();
+    result["measure_schema_version"] = BCLXML::currentSchemaVersion().str();
+    return result;
+  }
+
+  /** Returns {relative path: [size, mtime]} for every file under the measure directory, measures with identical stamps as
+   *  recorded after their last update have nothing to update and are skipped without being loaded */
+  Json::Value measureFileStamps(const openstudio::path& measureDir) {
+    Json::Value result(Json::objectValue);
+    for (auto const& dir_entry : openstudio::filesystem::recursive_directory_iterator{measureDir}) {
+      const auto& filePath = dir_entry.path();
+      if (openstudio::filesystem::is_regular_file(filePath)) {
+        Json::Value stamp(Json::arrayValue);
+        stamp.append(Json::UInt64(openstudio::filesystem::file_size(filePath)));
+        stamp.append(Json::Int64(openstudio::filesystem::last_write_time(filePath)));
+        result[openstudio::filesystem::relative(filePath, measureDir).generic_string()] = stamp;
+      }
+    }
+    return result;
+  }
+
+  Json::Value loadMeasureUpdateCache(const openstudio::path& cachePath) {
+    Json::Value cache(Json::objectValue);
+    if (openstudio::filesystem::is_regular_file(cachePath)) {
+      openstudio::filesystem::ifstream ifs(cachePath);
+      Json::CharReaderBuilder rbuilder;
+      std::string formattedErrors;
+      if (!Json::parseFromStream(rbuilder, ifs, &cache, &formattedErrors) || !cache.isObject()) {
+        fmt::print("Ignoring unreadable measure update cache '{}': {}\n", cachePath.string(), formattedErrors);
+        cache = Json::Value(Json::objectValue);
+      } else if (cache["version"] != measureUpdateCacheVersion()) {
+        fmt::print("Ignoring measure update cache '{}' written by another OpenStudio version\n", cachePath.string());
+        cache = Json::Value(Json::objectValue);
+      }
+    }
+    return cache;
+  }
+
+  /** Loads the measure and checks its files and xml for changes. Does not touch any script engine, so several measures can be checked at once */
+  boost::optional<BCLMeasure> loadAndCheckMeasure(const openstudio::path& directoryPath, bool& needsUpdate) {
+    needsUpdate = false;
 
     const auto& directoryPathStr = directoryPath.string();
 
@@ -129,7 +179,17 @@ namespace cli {
     // TODO: try catch like in measure_manager.rb?
     bool missing_fields = measure_->missingRequiredFields();
 
-    if (file_updates || xml_updates || missing_fields || readme_out_of_date) {
+    needsUpdate = file_updates || xml_updates || missing_fields || readme_out_of_date;
+    return measure_;
+  }
+
+  /** Extracts the arguments and outputs of a checked measure through the script engine of its language, and saves its measure.xml.
+   *  Script engines are process wide, so this must run on the main thread */
+  void updateCheckedMeasure(boost::optional<BCLMeasure>& measure_, bool needsUpdate, ScriptEngineInstance& rubyEngine,
+                            ScriptEngineInstance& pythonEngine) {
+    const auto directoryPathStr = measure_->directory().string();
+
+    if (needsUpdate) {
       fmt::print("Changes detected, updating '{}'\n", directoryPathStr);
 
       // TODO: the readme.md generation from readme.md.erb requires ruby.
@@ -362,7 +422,15 @@ print(f"{{measure_name}}, {{measure_typeinfo}}, {{measure_type}}")
       // Save the xml file with changes triggered by checkForUpdatesFiles() / checkForUpdatesXML() above
       measure_->save();
     }
+  }
 
+  boost::optional<BCLMeasure> getAndUpdateMeasure(const openstudio::path& directoryPath, ScriptEngineInstance& rubyEngine,
+                                                  ScriptEngineInstance& pythonEngine) {
+    bool needsUpdate = false;
+    auto measure_ = loadAndCheckMeasure(directoryPath, needsUpdate);
+    if (measure_) {
+      updateCheckedMeasure(measure_, needsUpdate, rubyEngine, pythonEngine);
+    }
     return measure_;
   }
 
@@ -401,8 +469,55 @@ server.start)ruby",
         }
       }
       fmt::print("Found {} measure directories to update\n", subDirPaths.size());
-      for (const auto& subDirPath : subDirPaths) {
-        getAndUpdateMeasure(subDirPath, rubyEngine, pythonEngine);
+
+      const openstudio::path cachePath = opt.directoryPath / measureUpdateCacheFileName;
+      const Json::Value cachedStamps = loadMeasureUpdateCache(cachePath)["measures"];
+
+      // Loading, checksumming and comparing the xml is plain C++ and runs on all cores. Measures whose files did not change
+      // since their last update are not even loaded
+      const size_t n = subDirPaths.size();
+      std::vector<Json::Value> stamps(n);
+      std::vector<boost::optional<BCLMeasure>> measures(n);
+      std::vector<char> upToDate(n, 0);
+      std::vector<char> needsUpdate(n, 0);
+      openstudio::parallelFor(n, [&](size_t i) {
+        const auto key = subDirPaths[i].filename().generic_string();
+        stamps[i] = measureFileStamps(subDirPaths[i]);
+        if (cachedStamps.isObject() && cachedStamps.isMember(key) && (cachedStamps[key] == stamps[i])) {
+          upToDate[i] = 1;
+          return;
+        }
+        bool thisNeedsUpdate = false;
+        measures[i] = loadAndCheckMeasure(subDirPaths[i], thisNeedsUpdate);
+        needsUpdate[i] = thisNeedsUpdate ? 1 : 0;
+      });
+
+      // Argument extraction goes through the embedded interpreters, which are process wide, so it stays on this thread
+      Json::Value newStamps(Json::objectValue);
+      size_t numUpToDate = 0;
+      for (size_t i = 0; i < n; ++i) {
+        const auto key = subDirPaths[i].filename().generic_string();
+        if (upToDate[i]) {
+          ++numUpToDate;
+          newStamps[key] = stamps[i];
+        } else if (measures[i]) {
+          updateCheckedMeasure(measures[i], needsUpdate[i] != 0, rubyEngine, pythonEngine);
+          // saving rewrote measure.xml
+          newStamps[key] = needsUpdate[i] ? measureFileStamps(subDirPaths[i]) : stamps[i];
+        }
+      }
+      fmt::print("Skipped {} measures with no changes since their last update\n", numUpToDate);
+
+      Json::Value cache(Json::objectValue);
+      cache["version"] = measureUpdateCacheVersion();
+      cache["measures"] = newStamps;
+      openstudio::filesystem::ofstream ofs(cachePath, std::ios_base::trunc);
+      if (ofs) {
+        Json::StreamWriterBuilder wbuilder;
+        wbuilder["indentation"] = "";
+        ofs << Json::writeString(wbuilder, cache);
+      } else {
+        fmt::print("Unable to write measure update cache '{}'\n", cachePath.string());
       }
 
     } else if (!opt.compute_arguments_model.empty()) {
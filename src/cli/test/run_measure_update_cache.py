@@ -0,0 +1,79 @@
+import argparse
+import json
+import shutil
+import subprocess
+import tempfile
+from pathlib import Path
+
+CACHE_FILE_NAME = ".openstudio_measure_update_cache.json"
+
+
+def validate_file(arg):
+    if (filepath := Path(arg)).is_file():
+        return filepath
+    else:
+        raise FileNotFoundError(arg)
+
+
+def validate_dir(arg):
+    if (dirpath := Path(arg)).is_dir():
+        return dirpath
+    else:
+        raise NotADirectoryError(arg)
+
+
+def update_all(os_cli_path: Path, measures_dir: Path) -> str:
+    command = [str(os_cli_path), "labs", "measure", "--update_all", str(measures_dir)]
+    print(f"Running: {' '.join(command)}")
+    r = subprocess.check_output(command, encoding="utf-8")
+    print(r)
+    return r
+
+
+def expect_skipped(output: str, n: int):
+    expected = f"Skipped {n} measures with no changes since their last update"
+    if expected not in output:
+        raise ValueError(f"Expected '{expected}' in the output")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Check the cache used by measure --update_all.")
+    parser.add_argument("os_cli_path", type=validate_file, help="Path to the OS CLI")
+    parser.add_argument("measure_dir", type=validate_dir, help="Path to a measure directory to copy and update")
+    args = parser.parse_args()
+    print(args)
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        measures_dir = Path(tmpdir)
+        shutil.copytree(args.measure_dir, measures_dir / args.measure_dir.name)
+        cache_path = measures_dir / CACHE_FILE_NAME
+
+        # First run updates the measure and writes the cache, with the version that wrote it
+        update_all(args.os_cli_path, measures_dir)
+        cache = json.loads(cache_path.read_text())
+        assert args.measure_dir.name in cache["measures"]
+        assert cache["version"]["openstudio_version"]
+        assert cache["version"]["measure_schema_version"]
+
+        # Nothing changed: the measure is skipped without being loaded
+        output = update_all(args.os_cli_path, measures_dir)
+        expect_skipped(output, 1)
+        assert "Attempting to load measure" not in output
+
+        # A cache written by another OpenStudio version is ignored, then rewritten
+        cache["version"]["openstudio_version"] = "0.0.0"
+        cache_path.write_text(json.dumps(cache))
+        output = update_all(args.os_cli_path, measures_dir)
+        assert "written by another OpenStudio version" in output
+        expect_skipped(output, 0)
+        output = update_all(args.os_cli_path, measures_dir)
+        expect_skipped(output, 1)
+
+        # An unreadable cache is ignored, then rewritten
+        cache_path.write_text("{ not json")
+        output = update_all(args.os_cli_path, measures_dir)
+        assert "Ignoring unreadable measure update cache" in output
+        expect_skipped(output, 0)
+        json.loads(cache_path.read_text())
+        output = update_all(args.os_cli_path, measures_dir)
+        expect_skipped(output, 1)
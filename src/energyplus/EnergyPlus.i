@@ -46,6 +46,9 @@
 %ignore ForwardTranslatorInitializer;
 %ignore openstudio::energyplus::detail::ForwardTranslatorInitializer;
 
+// std::function callbacks aren't wrapped
+%ignore openstudio::energyplus::ErrorFile::ErrorFile(const openstudio::path&, ErrorCallback);
+
 %include <energyplus/ErrorFile.hpp>
 %include <energyplus/ForwardTranslator.hpp>
 %include <energyplus/ReverseTranslator.hpp>
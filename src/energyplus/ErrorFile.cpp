@@ -29,17 +29,197 @@
 
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
-#include <boost/algorithm/string.hpp>
+#include "../utilities/core/Filesystem.hpp"
+
+#include <boost/optional.hpp>
+
+#include <cctype>
 
 namespace openstudio {
 namespace energyplus {
 
+  namespace {
+
+    // eplusout.err can reach hundreds of MB on long runs, so lines are classified with a hand written scanner rather than regexes.
+    // It accepts the same lines as the following patterns:
+    //   message:                  ^\s*\**\s+\*\*\s*([[:alpha:]]+)\s*\*\*(.*)$
+    //   continuation:             ^\s*\**\s+\*\*\s*~~~\s*\*\*(.*)$
+    //   completed successfully:   ^\s*\*+ EnergyPlus Completed Successfully.*   or   ^\s*\*+ GroundTempCalc\S* Completed Successfully.*
+    //   completed unsuccessfully: ^\s*\*+ EnergyPlus Terminated.*
+
+    enum class LineKind
+    {
+      Other,
+      Message,
+      Continuation,
+      CompletedSuccessfully,
+      Terminated
+    };
+
+    struct ClassifiedLine
+    {
+      LineKind kind = LineKind::Other;
+      std::string_view type;
+      std::string_view text;
+    };
+
+    bool isSpace(char c) {
+      return std::isspace(static_cast<unsigned char>(c)) != 0;
+    }
+
+    std::size_t skipSpaces(std::string_view line, std::size_t pos) {
+      while ((pos < line.size()) && isSpace(line[pos])) {
+        ++pos;
+      }
+      return pos;
+    }
+
+    std::size_t skipStars(std::string_view line, std::size_t pos) {
+      while ((pos < line.size()) && (line[pos] == '*')) {
+        ++pos;
+      }
+      return pos;
+    }
+
+    std::string_view trimRight(std::string_view sv) {
+      while (!sv.empty() && isSpace(sv.back())) {
+        sv.remove_suffix(1);
+      }
+      return sv;
+    }
+
+    std::string_view trim(std::string_view sv) {
+      sv = trimRight(sv);
+      while (!sv.empty() && isSpace(sv.front())) {
+        sv.remove_prefix(1);
+      }
+      return sv;
+    }
+
+    // What follows the '**' opening a message, eg ' Warning ** text' or '   ~~~   ** text'
+    bool classifyMessageBody(std::string_view line, std::size_t pos, ClassifiedLine& result) {
+      pos = skipSpaces(line, pos);
+      if (line.substr(pos, 3) == "~~~") {
+        result.kind = LineKind::Continuation;
+        pos += 3;
+      } else {
+        const std::size_t typeBegin = pos;
+        while ((pos < line.size()) && (std::isalpha(static_cast<unsigned char>(line[pos])) != 0)) {
+          ++pos;
+        }
+        if (pos == typeBegin) {
+          return false;
+        }
+        result.kind = LineKind::Message;
+        result.type = line.substr(typeBegin, pos - typeBegin);
+      }
+      pos = skipSpaces(line, pos);
+      if (line.substr(pos, 2) != "**") {
+        return false;
+      }
+      result.text = line.substr(pos + 2);
+      return true;
+    }
+
+    ClassifiedLine classifyLine(std::string_view line) {
+      ClassifiedLine result;
+
+      const std::size_t starsBegin = skipSpaces(line, 0);
+      const std::size_t starsEnd = skipStars(line, starsBegin);
+      const std::size_t nStars = starsEnd - starsBegin;
+
+      // '   ** Warning ** text': the leading whitespace is directly followed by the '**'
+      if ((starsBegin > 0) && (nStars == 2) && classifyMessageBody(line, starsEnd, result)) {
+        return result;
+      }
+      // '*** ** Warning ** text': other stars and some whitespace come first
+      if ((nStars > 0) && (starsEnd < line.size()) && isSpace(line[starsEnd])) {
+        const std::size_t pos = skipSpaces(line, starsEnd);
+        if ((line.substr(pos, 2) == "**") && classifyMessageBody(line, pos + 2, result)) {
+          return result;
+        }
+      }
+
+      result = ClassifiedLine{};
+      if (nStars > 0) {
+        const std::string_view rest = line.substr(starsEnd);
+        if (rest.starts_with(" EnergyPlus Completed Successfully")) {
+          result.kind = LineKind::CompletedSuccessfully;
+        } else if (rest.starts_with(" EnergyPlus Terminated")) {
+          result.kind = LineKind::Terminated;
+        } else if (rest.starts_with(" GroundTempCalc")) {
+          std::size_t pos = std::string_view(" GroundTempCalc").size();
+          while ((pos < rest.size()) && !isSpace(rest[pos])) {
+            ++pos;
+          }
+          if (rest.substr(pos).starts_with(" Completed Successfully")) {
+            result.kind = LineKind::CompletedSuccessfully;
+          }
+        }
+      }
+      return result;
+    }
+
+  }  // namespace
+
   /// constructor
-  ErrorFile::ErrorFile(const openstudio::path& errPath) : m_completed(false), m_completedSuccessfully(false) {
-    openstudio::filesystem::ifstream ifs(errPath);
-    parse(ifs);
-    ifs.close();
+  ErrorFile::ErrorFile(const openstudio::path& errPath) : m_errPath(errPath), m_completed(false), m_completedSuccessfully(false) {
+    update();
+    finish();
+  }
+
+  ErrorFile::ErrorFile(const openstudio::path& errPath, ErrorCallback callback)
+    : m_errPath(errPath), m_callback(std::move(callback)), m_completed(false), m_completedSuccessfully(false) {}
+
+  bool ErrorFile::update() {
+    // Nothing of interest is written after the completion line
+    if (m_completed) {
+      return false;
+    }
+
+    openstudio::filesystem::ifstream ifs(m_errPath, std::ios_base::binary);
+    if (!ifs.is_open()) {
+      return false;
+    }
+    ifs.seekg(static_cast<std::streamoff>(m_offset));
+    if (!ifs) {
+      return false;
+    }
+
+    bool parsedLine = false;
+
+    constexpr std::size_t chunkSize = 64 * 1024;
+    std::string buffer(chunkSize, '\0');
+    while (ifs.read(buffer.data(), chunkSize) || (ifs.gcount() > 0)) {
+      const auto nRead = static_cast<std::size_t>(ifs.gcount());
+      m_offset += nRead;
+
+      const std::string_view chunk(buffer.data(), nRead);
+      std::size_t lineBegin = 0;
+      for (auto eol = chunk.find('\n'); eol != std::string_view::npos; eol = chunk.find('\n', lineBegin)) {
+        const std::string_view line = chunk.substr(lineBegin, eol - lineBegin);
+        if (m_partialLine.empty()) {
+          parseLine(line);
+        } else {
+          m_partialLine.append(line);
+          parseLine(m_partialLine);
+          m_partialLine.clear();
+        }
+        parsedLine = true;
+        lineBegin = eol + 1;
+      }
+      m_partialLine.append(chunk.substr(lineBegin));
+    }
+
+    return parsedLine;
+  }
+
+  void ErrorFile::finish() {
+    if (!m_partialLine.empty()) {
+      parseLine(m_partialLine);
+      m_partialLine.clear();
+    }
+    flushMessage();
   }
 
   /// get warnings
@@ -67,97 +247,79 @@ namespace energyplus {
     return m_completedSuccessfully;
   }
 
-  void ErrorFile::parse(openstudio::filesystem::ifstream& is) {
-    std::string line;
-
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError(R"(^\s*\**\s+\*\*\s*([[:alpha:]]+)\s*\*\*(.*)$)");
-
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue(R"(^\s*\**\s+\*\*\s*~~~\s*\*\*(.*)$)");
-
-    // completed successfully
-    boost::regex completedSuccessful(R"(^\s*\*+ EnergyPlus Completed Successfully.*)");
-
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful(R"(^\s*\*+ GroundTempCalc\S* Completed Successfully.*)");
-
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful(R"(^\s*\*+ EnergyPlus Terminated.*)");
-
-    // repeat count
-
-    // read the file line by line using regexes
-    bool alreadyGotLine = false;
+  void ErrorFile::parseLine(std::string_view line) {
+    if (m_completed) {
+      return;
+    }
 
-    while (alreadyGotLine || std::getline(is, line)) {
+    const ClassifiedLine classified = classifyLine(line);
 
-      alreadyGotLine = false;
-      boost::smatch matches;
+    if (classified.kind == LineKind::Continuation) {
+      // continuation lines without a preceding warning or error are ignored
+      if (m_hasMessage) {
+        m_message += '\n';
+        m_message += trimRight(classified.text);
+      }
+      return;
+    }
 
-      LOG(Debug, "Parsing ErrorFile Line '" << line << "'");
+    // any other line ends the multi line warning or error
+    flushMessage();
 
-      // parse the file
-      if (boost::regex_search(line, matches, warningOrError)) {
+    switch (classified.kind) {
+      case LineKind::Message:
+        m_hasMessage = true;
+        m_messageType = trim(classified.type);
+        m_message = trim(classified.text);
+        break;
+      case LineKind::CompletedSuccessfully:
+        m_completed = true;
+        m_completedSuccessfully = true;
+        break;
+      case LineKind::Terminated:
+        m_completed = true;
+        m_completedSuccessfully = false;
+        break;
+      default:
+        break;
+    }
+  }
 
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second);
-        boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second);
-        boost::trim(warningOrErrorString);
+  void ErrorFile::flushMessage() {
+    if (!m_hasMessage) {
+      return;
+    }
+    m_hasMessage = false;
 
-        // read the rest of the multi line warning or error
-        while (true) {
-          // std::streampos pos = is.tellg();
-          if (!std::getline(is, line)) {
-            break;
-          }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)) {
-            std::string temp = std::string(matches[1].first, matches[1].second);
-            boost::trim_right(temp);
-            warningOrErrorString += "\n" + temp;
-          } else {
-            // unget the line
-            // is.seekg(pos);
-            // Instead of rewind then reread (which fails on Windows if you have LF line endings)
-            // We just use this bool to avoid having to re-read the line.
-            alreadyGotLine = true;
-            break;
-          }
-        }
+    LOG(Trace, "Error parsed: " << m_message);
 
-        LOG(Trace, "Error parsed: " << warningOrErrorString);
-
-        // correctly sort warnings and errors
-        try {
-          ErrorLevel level(warningOrErrorType);
-
-          switch (level.value()) {
-            case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Severe:
-              m_severeErrors.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Fatal:
-              m_fatalErrors.push_back(warningOrErrorString);
-              break;
-          }
+    // correctly sort warnings and errors
+    boost::optional<ErrorLevel> level;
+    try {
+      level = ErrorLevel(m_messageType);
+    } catch (...) {
+      LOG(Error, "Unknown warning or error level '" << m_messageType << "'");
+      return;
+    }
 
-        } catch (...) {
-          LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
+    switch (level->value()) {
+      case ErrorLevel::Warning:
+        m_warnings.push_back(std::move(m_message));
+        break;
+      case ErrorLevel::Severe:
+        m_severeErrors.push_back(std::move(m_message));
+        if (m_callback) {
+          m_callback(*level, m_severeErrors.back());
         }
-
-      } else if (boost::regex_match(line, completedSuccessful) || boost::regex_match(line, groundTempCompletedSuccessful)) {
-        m_completed = true;
-        m_completedSuccessfully = true;
         break;
-      } else if (boost::regex_match(line, completedUnsuccessful)) {
-        m_completed = true;
-        m_completedSuccessfully = false;
+      case ErrorLevel::Fatal:
+        m_fatalErrors.push_back(std::move(m_message));
+        if (m_callback) {
+          m_callback(*level, m_fatalErrors.back());
+        }
         break;
-      }
     }
+    m_message.clear();
   }
 
 }  // namespace energyplus
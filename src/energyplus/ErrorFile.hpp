@@ -36,7 +36,10 @@
 #include "../utilities/core/Enum.hpp"
 #include "../utilities/core/Logger.hpp"
 
+#include <cstdint>
+#include <functional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace openstudio {
@@ -57,9 +60,21 @@ namespace energyplus {
   class ENERGYPLUS_API ErrorFile
   {
    public:
-    /// constructor
+    /// called as soon as a severe or fatal error (including its continuation lines) has been parsed
+    using ErrorCallback = std::function<void(ErrorLevel level, const std::string& message)>;
+
+    /// constructor, parses the whole file
     ErrorFile(const openstudio::path& errPath);
 
+    /// streaming constructor, for a file EnergyPlus is still writing (it may not exist yet): nothing is parsed until update() is called
+    ErrorFile(const openstudio::path& errPath, ErrorCallback callback);
+
+    /// parse whatever was appended to the file since the last call, returns true if any new line was parsed
+    bool update();
+
+    /// to be called once EnergyPlus has exited: parses a trailing line without end of line, and the last message
+    void finish();
+
     /// get warnings
     std::vector<std::string> warnings() const;
 
@@ -78,7 +93,21 @@ namespace energyplus {
    private:
     REGISTER_LOGGER("energyplus.ErrorFile");
 
-    void parse(openstudio::filesystem::ifstream& is);
+    void parseLine(std::string_view line);
+
+    // store the message that was being accumulated, if any
+    void flushMessage();
+
+    openstudio::path m_errPath;
+    ErrorCallback m_callback;
+    // where update() resumes reading
+    std::uintmax_t m_offset = 0;
+    // last line, if EnergyPlus hasn't written the end of line yet
+    std::string m_partialLine;
+    // a warning or error is only complete once a line that isn't a continuation is seen
+    bool m_hasMessage = false;
+    std::string m_messageType;
+    std::string m_message;
 
     std::vector<std::string> m_warnings;
     std::vector<std::string> m_severeErrors;
@@ -69,6 +69,8 @@ namespace energyplus {
 
     m_untranslatedIdfObjects.clear();
 
+    m_untranslatedHandles.clear();
+
     m_logSink.resetStringStream();
 
     m_logSink.setThreadId(std::this_thread::get_id());
@@ -159,6 +161,8 @@ namespace energyplus {
 
     m_untranslatedIdfObjects.clear();
 
+    m_untranslatedHandles.clear();
+
     // if multiple runperiod objects in idf, remove them all
     vector<WorkspaceObject> runPeriods = m_workspace.getObjectsByType(IddObjectType::RunPeriod);
     if (runPeriods.size() > 1) {
@@ -246,17 +250,6 @@ namespace energyplus {
     return m_untranslatedIdfObjects;
   }
 
-  struct IdfObjectEqual
-  {
-    explicit IdfObjectEqual(const IdfObject& target) : m_target(target) {}
-
-    bool operator()(const IdfObject& other) const {
-      return (m_target == other);
-    }
-
-    IdfObject m_target;
-  };
-
   boost::optional<ModelObject> ReverseTranslator::translateAndMapWorkspaceObject(const WorkspaceObject& workspaceObject) {
     auto i = m_workspaceToModelMap.find(workspaceObject.handle());
 
@@ -1083,8 +1076,7 @@ namespace energyplus {
       m_workspaceToModelMap.insert(make_pair(workspaceObject.handle(), modelObject.get()));
     } else {
       if (addToUntranslated) {
-        if (std::find_if(m_untranslatedIdfObjects.begin(), m_untranslatedIdfObjects.end(), IdfObjectEqual(workspaceObject.idfObject()))
-            == m_untranslatedIdfObjects.end()) {
+        if (m_untranslatedHandles.insert(workspaceObject.handle()).second) {
           LOG(Trace, "Ignoring " << workspaceObject.briefDescription() << ".");
           m_untranslatedIdfObjects.push_back(workspaceObject.idfObject());
         }
@@ -35,6 +35,8 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 
+#include <set>
+
 namespace openstudio {
 
 class ProgressBar;
@@ -437,6 +439,9 @@ namespace energyplus {
 
     std::vector<IdfObject> m_untranslatedIdfObjects;
 
+    // handles of the workspace objects in m_untranslatedIdfObjects, so each one is listed once
+    std::set<openstudio::Handle> m_untranslatedHandles;
+
     StringStreamLogSink m_logSink;
 
     ProgressBar* m_progressBar;
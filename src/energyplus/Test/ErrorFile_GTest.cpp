@@ -33,11 +33,14 @@
 #include "../ErrorFile.hpp"
 
 #include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/Filesystem.hpp"
 
 #include <resources.hxx>
 
 #include <sstream>
 #include <fstream>
+#include <utility>
+#include <vector>
 
 using openstudio::energyplus::ErrorFile;
 
@@ -114,3 +117,55 @@ TEST_F(EnergyPlusFixture, ErrorFile_WarningsAndCrash) {
   EXPECT_FALSE(errorFile.completed());
   EXPECT_FALSE(errorFile.completedSuccessfully());
 }
+
+TEST_F(EnergyPlusFixture, ErrorFile_Streaming) {
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/SevereErrors.err");
+  const ErrorFile reference(path);
+
+  openstudio::filesystem::ifstream ifs(path, std::ios_base::binary);
+  ASSERT_TRUE(ifs.is_open());
+  std::stringstream ss;
+  ss << ifs.rdbuf();
+  const std::string content = ss.str();
+
+  openstudio::path streamedPath = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/ErrorFile_Streaming.err");
+  if (openstudio::filesystem::exists(streamedPath)) {
+    openstudio::filesystem::remove(streamedPath);
+  }
+
+  std::vector<std::pair<openstudio::energyplus::ErrorLevel, std::string>> callbacks;
+  ErrorFile errorFile(streamedPath, [&callbacks](openstudio::energyplus::ErrorLevel level, const std::string& message) {
+    callbacks.emplace_back(level, message);
+  });
+  // the file doesn't exist yet
+  EXPECT_FALSE(errorFile.update());
+
+  // Write it in chunks that split lines, like EnergyPlus flushing its buffer
+  {
+    openstudio::filesystem::ofstream ofs(streamedPath, std::ios_base::binary);
+    ASSERT_TRUE(ofs.is_open());
+    constexpr std::size_t chunkSize = 777;
+    for (std::size_t pos = 0; pos < content.size(); pos += chunkSize) {
+      ofs << content.substr(pos, chunkSize);
+      ofs.flush();
+      errorFile.update();
+      // Messages are reported as soon as they are complete
+      EXPECT_EQ(errorFile.severeErrors().size() + errorFile.fatalErrors().size(), callbacks.size());
+    }
+  }
+  errorFile.finish();
+
+  EXPECT_EQ(reference.warnings(), errorFile.warnings());
+  EXPECT_EQ(reference.severeErrors(), errorFile.severeErrors());
+  EXPECT_EQ(reference.fatalErrors(), errorFile.fatalErrors());
+  EXPECT_EQ(reference.completed(), errorFile.completed());
+  EXPECT_EQ(reference.completedSuccessfully(), errorFile.completedSuccessfully());
+
+  ASSERT_EQ(27u, callbacks.size());
+  EXPECT_EQ(openstudio::energyplus::ErrorLevel::Severe, callbacks.front().first.value());
+  EXPECT_EQ(reference.severeErrors()[0], callbacks.front().second);
+  EXPECT_EQ(openstudio::energyplus::ErrorLevel::Fatal, callbacks.back().first.value());
+  EXPECT_EQ("IP: Errors occurred on processing IDF file. Preceding condition(s) cause termination.", callbacks.back().second);
+
+  openstudio::filesystem::remove(streamedPath);
+}
@@ -1426,3 +1426,23 @@ TEST_F(EnergyPlusFixture, ReverseTranslator_CoilCoolingDX) {
   std::vector<Schedule> schedules = model.getModelObjects<Schedule>();
   ASSERT_EQ(1u, schedules.size());
 }
+
+TEST_F(EnergyPlusFixture, ReverseTranslator_UntranslatedIdfObjects_Unique) {
+  // EnergyManagementSystem:OutputVariable re-visits every workspace object, the untranslated Branch must still be listed once
+  Workspace ws(StrictnessLevel::Draft, IddFileType(IddFileType::EnergyPlus));
+  OptionalWorkspaceObject branch = ws.addObject(IdfObject(IddObjectType::Branch));
+  ASSERT_TRUE(branch);
+  branch->setName("Branch 1");
+  for (unsigned i = 0; i < 3; ++i) {
+    OptionalWorkspaceObject emsOutputVariable = ws.addObject(IdfObject(IddObjectType::EnergyManagementSystem_OutputVariable));
+    ASSERT_TRUE(emsOutputVariable);
+    emsOutputVariable->setName("EMS Output Variable " + std::to_string(i));
+  }
+
+  ReverseTranslator translator;
+  Model model = translator.translateWorkspace(ws);
+
+  std::vector<IdfObject> untranslated = translator.untranslatedIdfObjects();
+  EXPECT_EQ(1, std::count_if(untranslated.begin(), untranslated.end(),
+                             [](const IdfObject& idfObject) { return idfObject.iddObject().type() == IddObjectType::Branch; }));
+}
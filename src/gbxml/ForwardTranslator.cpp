@@ -122,9 +122,9 @@ namespace gbxml {
       doc.save(file, "  ");
       file.close();
 
-      // validate the gbxml after forward translation
+      // validate the gbxml after forward translation, no need to read it back from disk
       auto gbxmlValidator = XMLValidator::gbxmlValidator();
-      gbxmlValidator.validate(path);
+      gbxmlValidator.validate(doc);
 
       return result;
     }
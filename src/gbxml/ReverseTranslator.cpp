@@ -76,6 +76,7 @@
 
 #include <pugixml.hpp>
 #include <algorithm>
+#include <iterator>
 #include <locale>
 
 namespace openstudio {
@@ -109,18 +110,21 @@ namespace gbxml {
 
     if (openstudio::filesystem::exists(path)) {
 
-      // validate the gbxml prior to reverse translation
-      auto gbxmlValidator = XMLValidator::gbxmlValidator();
-      gbxmlValidator.validate(path);
-
       openstudio::filesystem::ifstream file(path, std::ios_base::binary);
       if (file.is_open()) {
+        // read the file once, then validate and load from the same buffer
+        std::string gbXML_str((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        file.close();
+
+        // validate the gbxml prior to reverse translation
+        auto gbxmlValidator = XMLValidator::gbxmlValidator();
+        gbxmlValidator.validateString(gbXML_str);
+
         pugi::xml_document doc;
-        auto load_result = doc.load(file);
+        auto load_result = doc.load_buffer(gbXML_str.data(), gbXML_str.size());
         if (load_result) {
           result = this->convert(doc.document_element());
         }
-        file.close();
       }
       // JWD: Would be nice to add some error handling here
     }
@@ -22,8 +22,9 @@
 %import(module="openstudiomodel") <model/ModelObject.hpp>
 #endif
 
-// ignore specific overload of GltfForwardTranslator::modelToGLTF to avoid dealing with std::function<void(double)>updatePercentage
+// ignore specific overloads of GltfForwardTranslator::modelToGLTF / modelToGLB to avoid dealing with std::function<void(double)>updatePercentage
 %ignore openstudio::gltf::GltfForwardTranslator::modelToGLTF(const model::Model& model, std::function<void(double)> updatePercentage, const path& outputPath);
+%ignore openstudio::gltf::GltfForwardTranslator::modelToGLB(const model::Model& model, std::function<void(double)> updatePercentage, const path& outputPath);
 
 %{
   #include <utilities/core/Path.hpp>
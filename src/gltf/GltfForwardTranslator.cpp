@@ -75,6 +75,8 @@
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Compare.hpp"
+#include "../utilities/core/Filesystem.hpp"
+#include "../utilities/core/ParallelFor.hpp"
 #include "../utilities/geometry/Point3d.hpp"
 #include "../utilities/geometry/Plane.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
@@ -91,7 +93,9 @@
 #include <algorithm>
 #include <iterator>
 #include <numeric>
+#include <thread>
 #include <type_traits>
+#include <unordered_map>
 
 namespace openstudio {
 namespace gltf {
@@ -151,6 +155,82 @@ namespace gltf {
     return (allPoints.size() - 1);
   }
 
+  namespace {
+
+    // What we need from the model to mesh one planar surface. It is gathered on the main thread so that the triangulation,
+    // which only works on plain geometry, can be spread over worker threads
+    struct PlanarSurfaceMeshInput
+    {
+      Point3dVector vertices;
+      Point3dVectorVector subSurfaceVertices;
+    };
+
+    struct PlanarSurfaceMesh
+    {
+      std::vector<size_t> faceIndices;
+      Point3dVector allVertices;
+      bool triangulationFailed = false;
+      // What meshing logged, and whether that was on the calling thread where m_logSink already saw it
+      std::vector<LogMessage> logMessages;
+      bool loggedOnCallingThread = false;
+    };
+
+    // Runs func and returns what it logs on the current thread at Warn and above. The translator's sink only listens to the calling
+    // thread, so this is how messages logged on worker threads get back to it
+    template <typename Func>
+    std::vector<LogMessage> logMessagesOnThisThread(Func&& func) {
+      StringStreamLogSink sink;
+      // The sink listens to every thread until it is filtered, drop whatever it caught in between
+      sink.disable();
+      sink.setLogLevel(Warn);
+      sink.setThreadId(std::this_thread::get_id());
+      sink.resetStringStream();
+      sink.enable();
+      func();
+      return sink.logMessages();
+    }
+
+    PlanarSurfaceMesh meshPlanarSurface(const PlanarSurfaceMeshInput& input, bool triangulateSurfaces) {
+      PlanarSurfaceMesh result;
+
+      Transformation t = Transformation::alignFace(input.vertices);
+      Transformation tInv = t.inverse();
+      Point3dVector faceVertices = reverse(tInv * input.vertices);
+
+      Point3dVectorVector faceSubVertices;
+      faceSubVertices.reserve(input.subSurfaceVertices.size());
+      for (const auto& subSurfaceVertices : input.subSurfaceVertices) {
+        faceSubVertices.push_back(reverse(tInv * subSurfaceVertices));
+      }
+
+      Point3dVectorVector finalFaceVertices;
+      if (triangulateSurfaces) {
+        finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
+        result.triangulationFailed = finalFaceVertices.empty();
+      } else {
+        finalFaceVertices.push_back(faceVertices);
+      }
+
+      size_t nFaceVertices = 0;
+      for (const auto& finalFaceVerts : finalFaceVertices) {
+        nFaceVertices += finalFaceVerts.size();
+      }
+      result.faceIndices.reserve(nFaceVertices);
+
+      for (const auto& finalFaceVerts : finalFaceVertices) {
+        Point3dVector finalVerts = t * finalFaceVerts;
+        auto it = finalVerts.rbegin();
+        auto itend = finalVerts.rend();
+        for (; it != itend; ++it) {
+          result.faceIndices.push_back(getOrCreateVertexIndexT(*it, result.allVertices));
+        }
+      }
+
+      return result;
+    }
+
+  }  // namespace
+
   template <typename T>
   std::vector<T> getObjectsAndSort(const model::Model& model) {
     std::vector<T> objects;
@@ -250,20 +330,36 @@ namespace gltf {
     // add model specific materials
     // End Region CREATE MATERIALS
 
-    TransformationVector transformStack{Transformation{}};
-
     std::vector<double> matrixDefaultTransformation{1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0};
 
-    // We prepare a vector of Materials
+    // We prepare a vector of Materials, indexed by name.
+    // Each one is added to the gltfModel once, the first time a surface uses it
     std::vector<GltfMaterialData> allMaterials = GltfMaterialData::buildMaterials(model);
-
-    // TODO: make it deterministic by sorting!
-    // std::sort(objects.begin(), objects.end(), WorkspaceObjectNameLess());
-
-    for (const auto& planarSurface : planarSurfaces) {
+    std::unordered_map<std::string, size_t> allMaterialIndices;
+    for (size_t i = allMaterials.size(); i-- > 0;) {
+      // Iterating backwards so that duplicate names resolve to the first one, like a linear search would
+      allMaterialIndices[allMaterials[i].materialName()] = i;
+    }
+    // Index in gltfModel.materials of each entry of allMaterials, -1 until used
+    std::vector<int> gltfMaterialIndices(allMaterials.size(), -1);
+
+    const size_t nPlanarSurfaces = planarSurfaces.size();
+    nodes.reserve(nodes.size() + nPlanarSurfaces);
+    meshes.reserve(nPlanarSurfaces);
+    accessors.reserve(3 * nPlanarSurfaces);
+
+    std::vector<PlanarSurfaceMeshInput> meshInputs(nPlanarSurfaces);
+    std::vector<Vector3d> outwardNormals;
+    outwardNormals.reserve(nPlanarSurfaces);
+    std::vector<int> materialIndices;
+    materialIndices.reserve(nPlanarSurfaces);
+
+    // Everything that touches the model happens here, on this thread
+    for (size_t i = 0; i < nPlanarSurfaces; ++i) {
       // Start Region MAIN LOOP
       //
       // TODO: MOVE THAT ENTIRE LOGIC TO THE GltfUserData file? (and rename to GltfPlanarSurfaceData and make it export a Node directly)
+      const auto& planarSurface = planarSurfaces[i];
       std::string planarSurfaceName = planarSurface.nameString();
       // Construct in place
       tinygltf::Node& node = nodes.emplace_back();
@@ -274,22 +370,25 @@ namespace gltf {
       if (boost::optional<model::PlanarSurfaceGroup> planarSurfaceGroup_ = planarSurface.planarSurfaceGroup()) {
         buildingTransformation = planarSurfaceGroup_->buildingTransformation();
       }
-      // get the vertices
-      Point3dVector vertices = planarSurface.vertices();
-      Transformation& t = transformStack.emplace_back(Transformation::alignFace(vertices));
-      Transformation tInv = t.inverse();
-      Point3dVector faceVertices = reverse(tInv * vertices);
       std::vector<double> matrix = openstudio::toStandardVector(buildingTransformation.vector());
 
       // Adding a check to avoid warning "NODE_MATRIX_DEFAULT"  <Do not specify default transform matrix>.
       // This is the identity_matrix<4>
       if (matrixDefaultTransformation != matrix) {
-        node.matrix = matrix;
-      } else {
-        node.matrix = {};
+        node.matrix = std::move(matrix);
       }
       node.mesh = meshes.size();
 
+      // get vertices of the surface and of all its sub surfaces
+      PlanarSurfaceMeshInput& meshInput = meshInputs[i];
+      meshInput.vertices = planarSurface.verticesView();
+      if (auto surface_ = planarSurface.optionalCast<model::Surface>()) {
+        for (const auto& subSurface : surface_->subSurfaces()) {
+          meshInput.subSurfaceVertices.push_back(subSurface.verticesView());
+        }
+      }
+      outwardNormals.push_back(planarSurface.outwardNormal());
+
       // EXTRAS
 
       // TODO: Based on flag add UserData to nodes..
@@ -297,71 +396,74 @@ namespace gltf {
       GltfUserData glTFUserData(planarSurface);
 
       tinygltf::Mesh& targetMesh = meshes.emplace_back();
-      targetMesh.name = planarSurfaceName;
+      targetMesh.name = std::move(planarSurfaceName);
 
       auto matName = glTFUserData.surfaceTypeMaterialName();
-      size_t materialIndex = 0;
-      auto it = std::find_if(materials.cbegin(), materials.cend(), [&matName](const auto& mat) { return mat.name == matName; });
-      if (it != materials.cend()) {
-        materialIndex = std::distance(materials.cbegin(), it);
-      } else {
-        auto it2 = std::find_if(allMaterials.cbegin(), allMaterials.cend(), [&matName](const auto& mat) { return mat.materialName() == matName; });
-        if (it2 == allMaterials.cend()) {
-          it2 = allMaterials.cbegin();  // This is always the "Undefined" material
-        }
-        materialIndex = materials.size();
+      auto it = allMaterialIndices.find(matName);
+      // Index 0 is always the "Undefined" material
+      size_t allMaterialIndex = (it == allMaterialIndices.end()) ? 0 : it->second;
+      int& materialIndex = gltfMaterialIndices[allMaterialIndex];
+      if (materialIndex < 0) {
+        materialIndex = static_cast<int>(materials.size());
         // add to gltfModel
-        materials.emplace_back(it2->toGltf());
+        materials.emplace_back(allMaterials[allMaterialIndex].toGltf());
       }
+      materialIndices.push_back(materialIndex);
 
-      // get vertices of all sub surfaces
-      Point3dVectorVector faceSubVertices;
-      if (auto surface_ = planarSurface.optionalCast<model::Surface>()) {
-        for (const auto& subSurface : surface_->subSurfaces()) {
-          faceSubVertices.push_back(reverse(tInv * subSurface.vertices()));
-        }
-      }
+      // TODO: Based on a flag override UserData attribute
+      // Addition of UserData as Extras to the node
+      node.extras = tinygltf::Value(glTFUserData.toExtras());
+    }
 
-      Point3dVectorVector finalFaceVertices;
-      if (triangulateSurfaces) {
-        finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
-        if (finalFaceVertices.empty()) {
-          LOG_FREE(Error, "modelToGLTF",
-                   "Failed to triangulate surface " << planarSurfaceName << " with " << faceSubVertices.size() << " sub surfaces");
+    // Triangulation and vertex welding only need the gathered geometry, each surface writes to its own slot
+    const std::thread::id callingThreadId = std::this_thread::get_id();
+    std::vector<PlanarSurfaceMesh> surfaceMeshes(nPlanarSurfaces);
+    parallelFor(nPlanarSurfaces, [&](size_t i) {
+      PlanarSurfaceMesh surfaceMesh;
+      std::vector<LogMessage> logMessages =
+        logMessagesOnThisThread([&]() { surfaceMesh = meshPlanarSurface(meshInputs[i], triangulateSurfaces); });
+      surfaceMesh.logMessages = std::move(logMessages);
+      // parallelFor runs inline when there is a single thread or surface
+      surfaceMesh.loggedOnCallingThread = (std::this_thread::get_id() == callingThreadId);
+      surfaceMeshes[i] = std::move(surfaceMesh);
+    });
+
+    // Size the binary buffers once, the per surface padding is at most a few bytes
+    size_t nIndexBytes = 0;
+    size_t nCoordinateBytes = 0;
+    for (const auto& surfaceMesh : surfaceMeshes) {
+      nIndexBytes += surfaceMesh.faceIndices.size() * sizeof(size_t) + 8;
+      nCoordinateBytes += 2 * surfaceMesh.allVertices.size() * 3 * sizeof(float) + 8;
+    }
+    indicesBuffer.reserve(nIndexBytes);
+    coordinatesBuffer.reserve(nCoordinateBytes);
+
+    // Append to the buffers in surface order, so the output doesn't depend on how the work was scheduled
+    for (size_t i = 0; i < nPlanarSurfaces; ++i) {
+      const PlanarSurfaceMesh& surfaceMesh = surfaceMeshes[i];
+      tinygltf::Mesh& targetMesh = meshes[i];
+      if (!surfaceMesh.loggedOnCallingThread) {
+        for (const auto& logMessage : surfaceMesh.logMessages) {
+          LOG_FREE(logMessage.logLevel(), logMessage.logChannel(), logMessage.logMessage());
         }
-      } else {
-        finalFaceVertices.push_back(faceVertices);
       }
-
-      Point3dVector allVertices;
-      Point3dVector triangleVertices;
-      std::vector<size_t> faceIndices;
-      for (const auto& finalFaceVerts : finalFaceVertices) {
-        Point3dVector finalVerts = t * finalFaceVerts;
-        triangleVertices.insert(triangleVertices.end(), finalVerts.begin(), finalVerts.end());
-        auto it = finalVerts.rbegin();
-        auto itend = finalVerts.rend();
-        for (; it != itend; ++it) {
-          faceIndices.push_back(getOrCreateVertexIndexT(*it, allVertices));
-        }
+      if (surfaceMesh.triangulationFailed) {
+        LOG_FREE(Error, "modelToGLTF",
+                 "Failed to triangulate surface " << targetMesh.name << " with " << meshInputs[i].subSurfaceVertices.size() << " sub surfaces");
       }
 
-      Vector3d outwardNormal = planarSurface.outwardNormal();
-      Vector3dVector normalVectors(allVertices.size(), outwardNormal);
+      Vector3dVector normalVectors(surfaceMesh.allVertices.size(), outwardNormals[i]);
 
-      detail::ShapeComponentIds shapeComponentIds(faceIndices, allVertices, normalVectors, indicesBuffer, coordinatesBuffer, accessors);
+      detail::ShapeComponentIds shapeComponentIds(surfaceMesh.faceIndices, surfaceMesh.allVertices, normalVectors, indicesBuffer,
+                                                  coordinatesBuffer, accessors);
 
       tinygltf::Primitive& thisPrimitive = targetMesh.primitives.emplace_back();
       thisPrimitive.attributes["NORMAL"] = shapeComponentIds.normalsAccessorId;
       thisPrimitive.attributes["POSITION"] = shapeComponentIds.verticesAccessorId;
       thisPrimitive.indices = shapeComponentIds.indicesAccessorId;
-      thisPrimitive.material = static_cast<int>(materialIndex);
+      thisPrimitive.material = materialIndices[i];
       thisPrimitive.mode = TINYGLTF_MODE_TRIANGLES;
 
-      // TODO: Based on a flag override UserData attribute
-      // Addition of UserData as Extras to the node
-      node.extras = tinygltf::Value(glTFUserData.toExtras());
-
       n += 1;
       updatePercentage(100.0 * n / N);
       // End Region MAIN
@@ -381,16 +483,14 @@ namespace gltf {
       indicesBuffer.push_back(0x00);  // padding bytes
     }
 
-    std::vector<unsigned char> allBuffer = indicesBuffer;  //std::move(_indicesBuffer);
-    allBuffer.insert(allBuffer.end(), coordinatesBuffer.begin(), coordinatesBuffer.end());
-
-    buffer.data = allBuffer;
-
     indicesBv.byteLength = indicesBuffer.size();
     indicesBv.byteOffset = 0;
 
     coordinatesBv.byteLength = coordinatesBuffer.size();
     coordinatesBv.byteOffset = indicesBuffer.size();
+
+    buffer.data = std::move(indicesBuffer);
+    buffer.data.insert(buffer.data.end(), coordinatesBuffer.begin(), coordinatesBuffer.end());
     // End Region BUILD SCENE | ELEMENT
 
     // Other tie ups
@@ -413,7 +513,7 @@ namespace gltf {
       return "";
     }
 
-    auto gltfModel = gltfModel_.get();
+    auto& gltfModel = gltfModel_.get();
 
     // Save it to a file
     // glTF Parser/Serialier context
@@ -440,14 +540,14 @@ namespace gltf {
 
   bool GltfForwardTranslator::modelToGLTF(const model::Model& model, std::function<void(double)> updatePercentage, const path& outputPath) {
 
-    boost::optional<tinygltf::Model> gltfModel_ = toGltfModel(model, [](double percentage) {});
+    boost::optional<tinygltf::Model> gltfModel_ = toGltfModel(model, updatePercentage);
     if (!gltfModel_) {
       LOG(Error, "Failed to prepare GLTF model");
-      return "";
+      return false;
     }
 
     // Save it to a file
-    auto gltfModel = gltfModel_.get();
+    auto& gltfModel = gltfModel_.get();
 
     // glTF Parser/Serialier context
     tinygltf::TinyGLTF ctx;
@@ -464,6 +564,44 @@ namespace gltf {
     return ret;
   }
 
+  // Exports a binary glTF (GLB) against a Model
+  // returns : exports a GLB file against a Model
+  bool GltfForwardTranslator::modelToGLB(const model::Model& model, const path& outputPath) {
+    return modelToGLB(
+      model, [](double percentage) {}, outputPath);
+  }
+
+  bool GltfForwardTranslator::modelToGLB(const model::Model& model, std::function<void(double)> updatePercentage, const path& outputPath) {
+
+    boost::optional<tinygltf::Model> gltfModel_ = toGltfModel(model, updatePercentage);
+    if (!gltfModel_) {
+      LOG(Error, "Failed to prepare GLTF model");
+      return false;
+    }
+
+    openstudio::filesystem::ofstream file(outputPath, std::ios_base::binary);
+    if (!file.is_open()) {
+      LOG(Error, "Could not open '" << toString(outputPath) << "' for writing");
+      return false;
+    }
+
+    // The binary chunk is written straight from the buffer to the file: no base64 copy of it, and no JSON string holding it
+    tinygltf::TinyGLTF ctx;
+    ctx.SetStoreOriginalJSONForExtrasAndExtensions(true);
+    bool ret = ctx.WriteGltfSceneToStream(&gltfModel_.get(), file,
+                                          false,  // pretty print
+                                          true);  // write binary
+    file.close();
+    if (!ret || file.fail()) {
+      LOG(Error, "Writing GLB to '" << toString(outputPath) << "' failed");
+      ret = false;
+    }
+
+    updatePercentage(100.0);
+
+    return ret;
+  }
+
   // TODO: either rename, or properly populate the model...
   // To populate a GLTF Model from an existing GLTF file.
   // also exports a gltf file with a .bin file (non embeded version).
@@ -66,6 +66,11 @@ namespace gltf {
     bool modelToGLTF(const model::Model& model, const path& outputPath);
     bool modelToGLTF(const model::Model& model, std::function<void(double)> updatePercentage, const path& outputpath);
 
+    /** Convert an OpenStudio Model to binary Gltf (GLB) format. Surfaces are triangulated in parallel, and the binary chunk is
+     *  written directly to the file instead of being base64 encoded into the JSON, which makes this the better choice for large models */
+    bool modelToGLB(const model::Model& model, const path& outputPath);
+    bool modelToGLB(const model::Model& model, std::function<void(double)> updatePercentage, const path& outputPath);
+
     /** Convert an OpenStudio Model to Gltf format but as a JSON string */
     std::string modelToGLTFString(const model::Model& model);
 
@@ -109,26 +109,25 @@ namespace gltf {
       indAccessor.minValues = {static_cast<double>(*min)};
       indAccessor.maxValues = {static_cast<double>(*max)};
 
-      std::vector<unsigned char> indicesBufferData;
-      for (const auto index : faceIndices) {
-        std::vector<unsigned char> arrayOfByte;
-        if (ct == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE) {
-          arrayOfByte.push_back((unsigned char)index);
-          // } else if (ct == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) {
-          //  arrayOfByte = splitValueToBytes(index);
-        } else {
-          arrayOfByte = splitValueToBytes(index);
+      // Write straight into the shared buffer, this is called once per surface
+      const size_t startingBufferSize = indicesBuffer.size();
+      if (ct == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE) {
+        for (const auto index : faceIndices) {
+          indicesBuffer.push_back(static_cast<unsigned char>(index));
+        }
+      } else {
+        for (const auto index : faceIndices) {
+          std::vector<unsigned char> arrayOfByte = splitValueToBytes(index);
+          indicesBuffer.insert(indicesBuffer.end(), arrayOfByte.begin(), arrayOfByte.end());
         }
-        indicesBufferData.insert(indicesBufferData.end(), arrayOfByte.begin(), arrayOfByte.end());
       }
 
-      if (indicesBufferData.size() < 4) {
-        indicesBufferData.push_back(0x00);
+      if (indicesBuffer.size() - startingBufferSize < 4) {
+        indicesBuffer.push_back(0x00);
       }
-      indicesBuffer.insert(indicesBuffer.end(), indicesBufferData.begin(), indicesBufferData.end());
 
       const auto thisIndex = accessors.size();
-      accessors.push_back(indAccessor);
+      accessors.push_back(std::move(indAccessor));
       return thisIndex;
     }
 
@@ -152,14 +151,10 @@ namespace gltf {
         if (i > 2) {
           i = 0;
         }
-        std::vector<unsigned char> v;
         // TODO: ideally we should revisit this...
         // cppcheck-suppress invalidPointerCast
         const auto* ptr = reinterpret_cast<const unsigned char*>(&value);
-        for (size_t j = 0; j < sizeof(float); ++j) {
-          v.push_back(ptr[j]);
-        }
-        coordinatesBuffer.insert(coordinatesBuffer.end(), v.begin(), v.end());
+        coordinatesBuffer.insert(coordinatesBuffer.end(), ptr, ptr + sizeof(float));
       }
       // To Fix : offset 18 is not a multiple of Component Type length 4
       auto padding = coordinatesBuffer.size() % 4;
@@ -167,14 +162,8 @@ namespace gltf {
         coordinatesBuffer.push_back((unsigned)0);
       }
       // convert min and max to double
-      std::vector<double> min_d;
-      std::vector<double> max_d;
-      for (const auto mn : min) {
-        min_d.push_back((double)mn);
-      }
-      for (const auto mx : max) {
-        max_d.push_back((double)mx);
-      }
+      std::vector<double> min_d(min.begin(), min.end());
+      std::vector<double> max_d(max.begin(), max.end());
       tinygltf::Accessor coordAccessor;
       coordAccessor.bufferView = 1;
       coordAccessor.byteOffset = startingBufferPosition;
@@ -182,11 +171,11 @@ namespace gltf {
       coordAccessor.normalized = false;
       coordAccessor.count = values.size() / 3;
       coordAccessor.type = TINYGLTF_TYPE_VEC3;
-      coordAccessor.minValues = min_d;
-      coordAccessor.maxValues = max_d;
+      coordAccessor.minValues = std::move(min_d);
+      coordAccessor.maxValues = std::move(max_d);
 
       auto ret = accessors.size();
-      accessors.push_back(coordAccessor);
+      accessors.push_back(std::move(coordAccessor));
       return ret;
     }
 
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include "../GltfForwardTranslator.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/Space.hpp"
+#include "../../model/Space_Impl.hpp"
+#include "../../model/Surface.hpp"
+#include "../../model/Surface_Impl.hpp"
+#include "../../model/SubSurface.hpp"
+#include "../../utilities/core/Assert.hpp"
+#include "../../utilities/core/Filesystem.hpp"
+#include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/Path.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+
+#include <cmath>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// A campus of nSpaces single story boxes laid out on a grid, with windows on every exterior wall
+model::Model makeModelWithNSpaces(size_t nSpaces) {
+
+  Model m;
+
+  constexpr double width = 10.0;
+  constexpr double floorHeight = 3.0;
+  const auto nPerRow = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(nSpaces))));
+
+  for (size_t i = 0; i < nSpaces; ++i) {
+    double x = width * static_cast<double>(i % nPerRow);
+    double y = width * static_cast<double>(i / nPerRow);
+    Point3dVector pts{{x, y, 0}, {x, y + width, 0}, {x + width, y + width, 0}, {x + width, y, 0}};
+    auto space_ = Space::fromFloorPrint(pts, floorHeight, m);
+    OS_ASSERT(space_);
+  }
+
+  for (auto& surface : m.getConcreteModelObjects<Surface>()) {
+    if (surface.surfaceType() == "Wall") {
+      surface.setWindowToWallRatio(0.4);
+    }
+  }
+
+  return m;
+}
+
+static void BM_ModelToGLTF(benchmark::State& state) {
+
+  openstudio::Logger::instance().standardOutLogger().disable();
+  Model m = makeModelWithNSpaces(state.range(0));
+  openstudio::path outputPath = openstudio::filesystem::temp_directory_path() / toPath("GltfForwardTranslator_Benchmark.gltf");
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    gltf::GltfForwardTranslator ft;
+    bool result = ft.modelToGLTF(m, outputPath);
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_ModelToGLB(benchmark::State& state) {
+
+  openstudio::Logger::instance().standardOutLogger().disable();
+  Model m = makeModelWithNSpaces(state.range(0));
+  openstudio::path outputPath = openstudio::filesystem::temp_directory_path() / toPath("GltfForwardTranslator_Benchmark.glb");
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    gltf::GltfForwardTranslator ft;
+    bool result = ft.modelToGLB(m, outputPath);
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+// 1024 spaces is about 10000 surfaces and sub surfaces
+BENCHMARK(BM_ModelToGLTF)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
+BENCHMARK(BM_ModelToGLB)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(16, 1024)->Complexity();
@@ -67,6 +67,7 @@
 
 #include "../../osversion/VersionTranslator.hpp"
 
+#include "../../utilities/core/Filesystem.hpp"
 #include "../../utilities/core/Json.hpp"
 
 #include <resources.hxx>
@@ -539,6 +540,38 @@ TEST_F(GltfFixture, GltfForwardTranslator_ExampleModel) {
   ASSERT_TRUE(glTFUserData->boundaryMaterialName() == "Boundary_Ground");
 }
 
+TEST_F(GltfFixture, GltfForwardTranslator_ExampleModel_GLB) {
+  GltfForwardTranslator ft;
+  openstudio::path outputPath = resourcesPath() / toPath("utilities/Geometry/exampleModel.glb");
+  Model model = exampleModel();
+
+  std::vector<double> percentages;
+  bool isExported = ft.modelToGLB(
+    model, [&percentages](double percentage) { percentages.push_back(percentage); }, outputPath);
+  ASSERT_TRUE(isExported);
+  ASSERT_FALSE(percentages.empty());
+  EXPECT_DOUBLE_EQ(100.0, percentages.back());
+  EXPECT_TRUE(std::is_sorted(percentages.begin(), percentages.end()));
+
+  // 12-byte GLB header: magic, version, total length, all little endian uint32
+  ASSERT_TRUE(openstudio::filesystem::exists(outputPath));
+  openstudio::filesystem::ifstream file(outputPath, std::ios_base::binary);
+  ASSERT_TRUE(file.is_open());
+  char header[12];
+  file.read(header, 12);
+  ASSERT_TRUE(file.good());
+  EXPECT_EQ("glTF", std::string(header, 4));
+  auto readUInt32 = [&header](int offset) {
+    uint32_t value = 0;
+    for (int i = 3; i >= 0; --i) {
+      value = (value << 8) | static_cast<unsigned char>(header[offset + i]);
+    }
+    return value;
+  };
+  EXPECT_EQ(2u, readUInt32(4));
+  EXPECT_EQ(openstudio::filesystem::file_size(outputPath), readUInt32(8));
+}
+
 TEST_F(GltfFixture, GltfForwardTranslator_ParkUnder_Retail_Office_C2) {
   GltfForwardTranslator ft;
   openstudio::path output;
@@ -840,6 +873,26 @@ TEST_F(GltfFixture, GltfForwardTranslator_CreateTriangleGLTFTest) {
   ASSERT_TRUE(result_2);
 }
 
+TEST_F(GltfFixture, GltfForwardTranslator_TriangulationErrors) {
+  Model model;
+  Space space(model);
+
+  Surface flat(Point3dVector{{0, 10, 0}, {10, 10, 0}, {10, 0, 0}, {0, 0, 0}}, model);
+  flat.setSpace(space);
+  // One corner is lifted off the plane of the others, computeTriangulation refuses it
+  Surface warped(Point3dVector{{0, 10, 3}, {10, 10, 3.5}, {10, 0, 3}, {0, 0, 3}}, model);
+  warped.setSpace(space);
+
+  // Meshing runs on worker threads, its errors still belong to this translation
+  GltfForwardTranslator ft;
+  std::string s = ft.modelToGLTFString(model);
+  EXPECT_FALSE(s.empty());
+  std::vector<LogMessage> errors = ft.errors();
+  EXPECT_EQ(1, std::count_if(errors.begin(), errors.end(),
+                             [](const auto& error) { return error.logChannel() == "utilities.geometry.computeTriangulation"; }));
+  EXPECT_EQ(1, std::count_if(errors.begin(), errors.end(), [](const auto& error) { return error.logChannel() == "modelToGLTF"; }));
+}
+
 // Validation report
 // Format: glTF 2.0
 // Stats:
@@ -31,6 +31,8 @@
 // #endif
 
 %ignore openstudio::isomodel::mult;
+%ignore openstudio::isomodel::SimModel::simulate(const std::vector<openstudio::isomodel::SimModel>&, unsigned);
+%ignore openstudio::isomodel::UserModel::simulate;
 
 %rename("terrainClass=") openstudio::isomodel::UserModel::setTerrainClass(double value);
 %rename("floorArea=") openstudio::isomodel::UserModel::setFloorArea(double value);
@@ -29,6 +29,8 @@
 
 #include "SimModel.hpp"
 
+#include "../utilities/core/ParallelFor.hpp"
+
 #include <cmath>
 
 #if _DEBUG || (__GNUC__ && !NDEBUG)
@@ -274,6 +276,25 @@ namespace isomodel {
     return va;
   }
 
+  /**
+   * Evaluates an element-wise expression into a single freshly sized Vector.
+   * Used to fuse chains such as mult(mult(dif(a, b), c), d) into one pass with one allocation,
+   * the expression must apply the operations in the same order as the chain it replaces.
+   */
+  template <typename Expr>
+  Vector fused(size_t size, Expr expr) {
+    Vector result(size);
+    for (size_t i = 0; i < size; i++) {
+      result[i] = expr(i);
+    }
+    return result;
+  }
+
+  /// Scalar counterpart of div(), a zero denominator yields the largest double
+  inline double safeDiv(double numerator, double denominator) {
+    return (denominator == 0) ? std::numeric_limits<double>::max() : numerator / denominator;
+  }
+
   //End Utility Functions
   constexpr double daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
   constexpr double hoursInMonth[] = {744, 672, 744, 720, 744, 720, 744, 744, 720, 744, 720, 744};
@@ -344,8 +365,8 @@ namespace isomodel {
                                          const Vector& clockHourOccupied, const Vector& clockHourUnoccupied, Vector& v_hrs_sun_down_mo,
                                          Vector& frac_Pgh_wk_nt, Vector& frac_Pgh_wke_day, Vector& frac_Pgh_wke_nt, Vector& v_Tdbt_nt) const {
 
-    Matrix m_mhEgh = location->weather()->mhEgh();
-    Matrix m_mhdbt = location->weather()->mhdbt();
+    const Matrix& m_mhEgh = location->weather()->mhEgh();
+    const Matrix& m_mhdbt = location->weather()->mhdbt();
 
     // TODO: unreadVariable
     // Vector v_Tdbt_Day = prod(m_mhdbt, clockHourOccupied);
@@ -376,7 +397,7 @@ v_Egh_nt=(M_mhEgh*v_nt_hrs_yesno)./sum(v_nt_hrs_yesno);  %monthly avg Egh during
     Vector v_Wgh_wk_nt = mult(v_Egh_nt, weekdayUnoccupiedMegaseconds);
     Vector v_Wgh_wke_day = mult(v_Egh_day, weekendOccupiedMegaseconds);
     Vector v_Wgh_wke_nt = mult(v_Egh_nt, weekendUnoccupiedMegaseconds);
-    Vector v_Wgh_tot = sum(sum(v_Wgh_wk_day, v_Wgh_wk_nt), sum(v_Wgh_wke_day, v_Wgh_wke_nt));
+    Vector v_Wgh_tot = fused(v_Wgh_wk_day.size(), [&](size_t i) { return (v_Wgh_wk_day[i] + v_Wgh_wk_nt[i]) + (v_Wgh_wke_day[i] + v_Wgh_wke_nt[i]); });
     /**
 v_Wgh_wk_day=v_Egh_day.*v_Msec_wk_day; % monthly avg Egh energy (Wgh) during the week days
 v_Wgh_wk_nt=v_Egh_nt.*v_Msec_wk_nt;  %monthly avg Wgh during week nights
@@ -636,7 +657,7 @@ v_win_F_shgl = v_win_SDF.*v_win_SDF_frac;
     double n_win_F_W = 0.9;
     Vector v_g_gl = mult(v_g_gln, n_win_F_W);
 
-    v_win_A_sol = mult(mult(mult(v_win_F_shgl, v_g_gl), v_win_ff), v_win_A);
+    v_win_A_sol = fused(v_win_F_shgl.size(), [&](size_t i) { return v_win_F_shgl[i] * v_g_gl[i] * v_win_ff[i] * v_win_A[i]; });
 
 #ifdef DEBUG_ISO_MODEL_SIMULATION
     printVector("v_g_gln", v_g_gln);
@@ -665,7 +686,7 @@ v_win_A_sol=v_win_F_shgl.*v_g_gl.*(1-v_win_ff).*v_win_A;
       v_wall_R_sc[i] = n_R_sc_ext;
     }
     v_win_hr = mult(v_wall_emiss, 5.0);
-    v_wall_A_sol = mult(mult(mult(v_wall_alpha_sc, v_wall_R_sc), v_wall_U), v_wall_A);
+    v_wall_A_sol = fused(v_wall_alpha_sc.size(), [&](size_t i) { return v_wall_alpha_sc[i] * v_wall_R_sc[i] * v_wall_U[i] * v_wall_A[i]; });
     /*
 n_v_env_form_factors=[0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 1]; %formfactor_to_sky.  Walls are all 0.5, roof is 1.0
 n_R_sc_ext=0.04;  % vertical wall external convection surface heat resistance as per ISO 6946
@@ -760,7 +781,8 @@ end
     }
     double n_v_env_form_factors[] = {0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 1};
 
-    Vector v_wall_phi_r = mult(mult(mult(mult(v_wall_R_sc, v_wall_U), v_wall_A), v_win_hr), theta_er);
+    Vector v_wall_phi_r =
+      fused(v_wall_R_sc.size(), [&](size_t i) { return v_wall_R_sc[i] * v_wall_U[i] * v_wall_A[i] * v_win_hr[i] * theta_er[i]; });
     Vector v_wall_phi_sol(12);
     for (size_t i = 0; i < v_win_phi_sol.size(); i++) {
       for (size_t j = 0; j < temp.size(); j++) {
@@ -1249,8 +1271,12 @@ if T_cl_ctrl_flag ==1  % if the HVAC cooling controls are on
     */
     }
 
-    Vector v_Th_wk_avg = sum(sum(mult(v_Th_wk_day, frac_hrs_wk_day), mult(v_Th_wk_nt, frac_hrs_wk_nt)), mult(v_Th_wke_avg, frac_hrs_wke_tot));
-    Vector v_Tc_wk_avg = sum(sum(mult(v_Tc_wk_day, frac_hrs_wk_day), mult(v_Tc_wk_nt, frac_hrs_wk_nt)), mult(v_Tc_wke_avg, frac_hrs_wke_tot));
+    Vector v_Th_wk_avg = fused(v_Th_wk_day.size(), [&](size_t i) {
+      return (v_Th_wk_day[i] * frac_hrs_wk_day + v_Th_wk_nt[i] * frac_hrs_wk_nt) + v_Th_wke_avg[i] * frac_hrs_wke_tot;
+    });
+    Vector v_Tc_wk_avg = fused(v_Tc_wk_day.size(), [&](size_t i) {
+      return (v_Tc_wk_day[i] * frac_hrs_wk_day + v_Tc_wk_nt[i] * frac_hrs_wk_nt) + v_Tc_wke_avg[i] * frac_hrs_wke_tot;
+    });
 
     //v_Th_avg(v_Th_wk_avg);
     //v_Tc_avg(v_Tc_wk_avg);
@@ -1384,12 +1410,12 @@ v_qv_stack_cl=max(n_stack_coeff.*v_Q4pa*(h_stack.*abs(W.mdbt-v_Tc_avg)).^n_stack
     double n_wind_coeff = 0.0769;
     double n_dCp = 0.75;  // % conventional value for cp difference between windward and leeward sides for low rise buildings as per 15242
 
-    Vector v_qv_wind_ht =
-      mult(mult(pow(mult(mult(location->weather()->mwind(), location->weather()->mwind()), n_dCp * location->terrain()), n_wind_exp), v_Q4pa),
-           n_wind_coeff);  // % qv_wind_heating
-    Vector v_qv_wind_cl =
-      mult(mult(pow(mult(mult(location->weather()->mwind(), location->weather()->mwind()), n_dCp * location->terrain()), n_wind_exp), v_Q4pa),
-           n_wind_coeff);  // % qv_wind_cooling
+    const Vector& v_mwind = location->weather()->mwind();
+    const double windPressureCoeff = n_dCp * location->terrain();
+    Vector v_qv_wind_ht = fused(v_mwind.size(), [&](size_t i) {
+      return std::pow(v_mwind[i] * v_mwind[i] * windPressureCoeff, n_wind_exp) * v_Q4pa * n_wind_coeff;
+    });                                  // % qv_wind_heating
+    Vector v_qv_wind_cl(v_qv_wind_ht);  // % qv_wind_cooling, identical to heating
 
     printVector("v_qv_wind_ht", v_qv_wind_ht);
     printVector("v_qv_wind_cl", v_qv_wind_cl);
@@ -1515,8 +1541,11 @@ v_Hve_cl = n_rhoc_air*v_qve_cl/3600; % Hve (W/K/m2)  cooling
     double tau_H0 = 15;
     double a_H = a_H0 + tau / tau_H0;
 
-    Vector v_QT_ht = mult(mult(dif(v_Th_avg, location->weather()->mdbt()), megasecondsInMonth), H_tr);
-    Vector v_QV_ht = mult(mult(mult(v_Hve_ht, structure->floorArea()), dif(v_Th_avg, location->weather()->mdbt())), megasecondsInMonth);
+    const Vector& v_mdbt = location->weather()->mdbt();
+    const double floorArea = structure->floorArea();
+    Vector v_QT_ht = fused(v_Th_avg.size(), [&](size_t i) { return (v_Th_avg[i] - v_mdbt[i]) * megasecondsInMonth[i] * H_tr; });
+    Vector v_QV_ht =
+      fused(v_Hve_ht.size(), [&](size_t i) { return v_Hve_ht[i] * floorArea * (v_Th_avg[i] - v_mdbt[i]) * megasecondsInMonth[i]; });
     Vector v_Qtot_ht = sum(v_QT_ht, v_QV_ht);
     /*
   %% Heating and Cooling Needs
@@ -1564,9 +1593,11 @@ v_Qneed_ht = v_Qtot_ht - v_eta_g_H.*v_tot_mo_ht_gain; %QNH = QL,H - eta_G_H.*Q_G
 Qneed_ht_yr = sum(v_Qneed_ht);
    */
 
-    Vector v_QT_cl = mult(mult(dif(v_Tc_avg, location->weather()->mdbt()), H_tr), megasecondsInMonth);  // % QT for cooling in MJ
-    Vector v_QV_cl =
-      mult(mult(mult(v_Hve_cl, structure->floorArea()), dif(v_Tc_avg, location->weather()->mdbt())), megasecondsInMonth);  // % QT for coolin in MJ
+    Vector v_QT_cl =
+      fused(v_Tc_avg.size(), [&](size_t i) { return (v_Tc_avg[i] - v_mdbt[i]) * H_tr * megasecondsInMonth[i]; });  // % QT for cooling in MJ
+    Vector v_QV_cl = fused(v_Hve_cl.size(), [&](size_t i) {
+      return v_Hve_cl[i] * floorArea * (v_Tc_avg[i] - v_mdbt[i]) * megasecondsInMonth[i];
+    });  // % QT for coolin in MJ
     Vector v_Qtot_cl = sum(v_QT_cl, v_QV_cl);  // % QL = QT + QV for cooling = total cooling heat loss in MJ
 
     Vector v_gamma_H_cl = div(v_Qtot_cl, sum(v_tot_mo_ht_gain, std::numeric_limits<double>::min()));  //  %gamma_C = heat loss ratio Qloss/Qgain
@@ -1626,8 +1657,12 @@ T_sup_cl = In.cl_tset_occ-n_dT_supp_cl;  %cool air supply temp - assume 7C lower
 n_rhoC_a = 1.22521.*0.001012; % rho*Cp for air (MJ/m3/K)
 */
 
-    Vector v_Vair_ht = div(v_Qneed_ht, sum(mult(dif(T_sup_ht, v_Th_avg), n_rhoC_a), std::numeric_limits<double>::min()));
-    Vector v_Vair_cl = div(v_Qneed_cl, sum(mult(dif(v_Tc_avg, T_sup_cl), n_rhoC_a), std::numeric_limits<double>::min()));
+    Vector v_Vair_ht = fused(v_Qneed_ht.size(), [&](size_t i) {
+      return safeDiv(v_Qneed_ht[i], (T_sup_ht - v_Th_avg[i]) * n_rhoC_a + std::numeric_limits<double>::min());
+    });
+    Vector v_Vair_cl = fused(v_Qneed_cl.size(), [&](size_t i) {
+      return safeDiv(v_Qneed_cl[i], (v_Tc_avg[i] - T_sup_cl) * n_rhoC_a + std::numeric_limits<double>::min());
+    });
     ventilation->fanPower();
     ventilation->fanControlFactor();
     structure->floorArea();
@@ -1646,7 +1681,7 @@ n_rhoC_a = 1.22521.*0.001012; % rho*Cp for air (MJ/m3/K)
     LOG(Trace, "structure->floorArea() = " << structure->floorArea());
 #endif
 
-    v_Qfan_tot = div(div(fanPower, structure->floorArea()), 3600);  //% compute fan energy in kWh/m2
+    v_Qfan_tot = fused(fanPower.size(), [&](size_t i) { return safeDiv(safeDiv(fanPower[i], floorArea), 3600); });  //% compute fan energy in kWh/m2
 
     /*
 v_Vair_ht = v_Qneed_ht./(n_rhoC_a.*(T_sup_ht -v_Th_avg)+eps);  %compute volume of air moved for heating
@@ -1966,6 +2001,14 @@ end
   */
   }
 
+  std::vector<ISOResults> SimModel::simulate(const std::vector<SimModel>& simModels, unsigned numThreads) {
+    std::vector<ISOResults> results(simModels.size());
+    // simulate() only reads the shared inputs, so each model can be run independently
+    parallelFor(
+      simModels.size(), [&](size_t i) { results[i] = simModels[i].simulate(); }, numThreads);
+    return results;
+  }
+
   ISOResults SimModel::simulate() const {
     Vector weekdayOccupiedMegaseconds(12);
     Vector weekdayUnoccupiedMegaseconds(12);
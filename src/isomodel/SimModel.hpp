@@ -113,6 +113,14 @@ namespace isomodel {
      *  returns ISOResults which is a vector of EndUses, one EndUses per month of the year
      */
     ISOResults simulate() const;
+
+    /*
+     *  Runs the ISO Model calculations for a batch of SimModels, for instance the variants of a parametric sweep.
+     *  The models are spread over numThreads worker threads (0 uses the hardware concurrency),
+     *  results are returned in the same order as simModels.
+     */
+    static std::vector<ISOResults> simulate(const std::vector<SimModel>& simModels, unsigned numThreads = 0);
+
     REGISTER_LOGGER("openstudio.isomodel.SimModel");
 
    private:
@@ -326,3 +326,38 @@ TEST_F(ISOModelFixture, SimModel) {
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[10].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems));
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[11].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems));
 }
+
+TEST_F(ISOModelFixture, SimModel_Batch) {
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+
+  // a small sweep over the cooling setpoint
+  std::vector<UserModel> variants;
+  std::vector<ISOResults> expected;
+  for (int i = 0; i < 8; ++i) {
+    UserModel variant = userModel;
+    variant.setCoolingOccupiedSetpoint(22.0 + 0.5 * i);
+    expected.push_back(variant.toSimModel().simulate());
+    variants.push_back(variant);
+  }
+
+  std::vector<ISOResults> results = UserModel::simulate(variants, 4);
+  ASSERT_EQ(expected.size(), results.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    ASSERT_EQ(12u, results[i].monthlyResults.size());
+    EXPECT_DOUBLE_EQ(expected[i].totalEnergyUse(), results[i].totalEnergyUse());
+    for (size_t m = 0; m < 12; ++m) {
+      EXPECT_DOUBLE_EQ(expected[i].monthlyResults[m].getEndUse(EndUseFuelType::Electricity, EndUseCategoryType::Cooling),
+                       results[i].monthlyResults[m].getEndUse(EndUseFuelType::Electricity, EndUseCategoryType::Cooling));
+    }
+  }
+
+  // different setpoints give different results, and the serial path agrees with the threaded one
+  EXPECT_NE(results.front().totalEnergyUse(), results.back().totalEnergyUse());
+  std::vector<ISOResults> serialResults = UserModel::simulate(variants, 1);
+  ASSERT_EQ(results.size(), serialResults.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    EXPECT_DOUBLE_EQ(results[i].totalEnergyUse(), serialResults[i].totalEnergyUse());
+  }
+}
@@ -29,6 +29,8 @@
 
 #include "UserModel.hpp"
 
+#include <map>
+
 using namespace std;
 namespace openstudio {
 namespace isomodel {
@@ -600,6 +602,27 @@ namespace isomodel {
     }
   }
 
+  std::vector<ISOResults> UserModel::simulate(std::vector<UserModel>& userModels, unsigned numThreads) {
+    // variants of a sweep typically point at the same weather file, only parse each one once
+    std::map<std::pair<openstudio::path, openstudio::path>, std::shared_ptr<WeatherData>> weatherCache;
+
+    std::vector<SimModel> simModels;
+    simModels.reserve(userModels.size());
+    for (auto& userModel : userModels) {
+      if (!userModel._weather) {
+        auto key = std::make_pair(userModel._weatherFilePath, userModel._dataFile.parent_path());
+        auto it = weatherCache.find(key);
+        if (it == weatherCache.end()) {
+          it = weatherCache.emplace(key, userModel.loadWeather()).first;
+        }
+        userModel._weather = it->second;
+      }
+      simModels.push_back(userModel.toSimModel());
+    }
+
+    return SimModel::simulate(simModels, numThreads);
+  }
+
   std::shared_ptr<WeatherData> UserModel::loadWeather() {
     openstudio::path weatherFilename;
     //see if weather file path is absolute path
@@ -71,6 +71,12 @@ namespace isomodel {
      */
     SimModel toSimModel();
 
+    /**
+     * Generates and runs SimModels for a batch of UserModels, see SimModel::simulate(simModels, numThreads).
+     * UserModels that have not loaded their weather yet share a single WeatherData per weather file
+     */
+    static std::vector<ISOResults> simulate(std::vector<UserModel>& userModels, unsigned numThreads = 0);
+
     /**
      * Indicates whether or not the user model loaded in correctly
      * If either the ISO file or the Weather File cannot be found
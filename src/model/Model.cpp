@@ -65,6 +65,9 @@
 
 #include <boost/regex.hpp>
 
+#include <unordered_map>
+#include <unordered_set>
+
 using openstudio::IddObjectType;
 using openstudio::detail::WorkspaceObject_Impl;
 
@@ -78,6 +81,7 @@ namespace model {
     // default constructor
     Model_Impl::Model_Impl() : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio) {
       // careful not to call anything that calls shared_from_this here, this is not yet constructed
+      this->Workspace_Impl::onChange.connect<Model_Impl, &Model_Impl::clearResolvedDefaultConstructions>(this);
     }
 
     Model_Impl::Model_Impl(const IdfFile& idfFile) : Workspace_Impl(idfFile, StrictnessLevel(StrictnessLevel::Draft)) {
@@ -86,6 +90,7 @@ namespace model {
         LOG_AND_THROW("Models must be constructed with the OpenStudio Idd as the underlying "
                       << "data schema. (Attempted construction from IdfFile with IddFileType " << idfFile.iddFileType().valueDescription() << ".)");
       }
+      this->Workspace_Impl::onChange.connect<Model_Impl, &Model_Impl::clearResolvedDefaultConstructions>(this);
     }
 
     Model_Impl::Model_Impl(const openstudio::detail::Workspace_Impl& workspace, bool keepHandles)
@@ -96,6 +101,7 @@ namespace model {
                       << "data schema. (Attempted construction from Workspace with IddFileType " << workspace.iddFileType().valueDescription()
                       << ".)");
       }
+      this->Workspace_Impl::onChange.connect<Model_Impl, &Model_Impl::clearResolvedDefaultConstructions>(this);
     }
 
     // copy constructor, used for clone
@@ -105,6 +111,7 @@ namespace model {
         m_workflowJSON(WorkflowJSON(other.m_workflowJSON)) {
       // notice we are cloning the workflow and sqlfile too, if necessary
       // careful not to call anything that calls shared_from_this here, this is not yet constructed
+      this->Workspace_Impl::onChange.connect<Model_Impl, &Model_Impl::clearResolvedDefaultConstructions>(this);
     }
 
     // copy constructor used for cloneSubset
@@ -113,6 +120,7 @@ namespace model {
         m_sqlFile((other.m_sqlFile) ? (std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))) : (other.m_sqlFile)),
         m_workflowJSON(WorkflowJSON(other.m_workflowJSON)) {
       // notice we are cloning the workflow and sqlfile too, if necessary
+      this->Workspace_Impl::onChange.connect<Model_Impl, &Model_Impl::clearResolvedDefaultConstructions>(this);
     }
     Workspace Model_Impl::clone(bool keepHandles) const {
       // copy everything but objects
@@ -1363,13 +1371,103 @@ namespace model {
     }
 
     std::vector<openstudio::IdfObject> Model_Impl::purgeUnusedResourceObjects() {
+      // A resource has nonResourceObjectUseCount(true) > 0 when a non-resource object that is not one of its children points to it, or when
+      // a used resource points to it. Rather than recursing through sources() for every resource, build the reference graph once and mark
+      // the used resources by reachability. Resources are then removed in the same order as before, and the marks are updated from the
+      // objects each remove() reports, so the removed set is the same.
+      using HandleIndexMap = std::unordered_map<Handle, size_t, boost::hash<boost::uuids::uuid>>;
+
       ResourceObjectVector resources = model().getModelObjects<ResourceObject>();
+      const size_t n = resources.size();
+
+      HandleIndexMap resourceIndices;
+      resourceIndices.reserve(n);
+      for (size_t i = 0; i < n; ++i) {
+        resourceIndices.emplace(resources[i].handle(), i);
+      }
+
+      // counted uses of each resource, from non-resource sources and from used resource sources
+      std::vector<unsigned> uses(n, 0);
+      std::vector<bool> used(n, false);
+      // resources each resource is a source of
+      std::vector<std::vector<size_t>> resourceTargets(n);
+      // resources each non-resource source counts as a use of
+      std::unordered_map<Handle, std::vector<size_t>, boost::hash<boost::uuids::uuid>> nonResourceTargets;
+
+      for (size_t i = 0; i < n; ++i) {
+        std::unordered_set<Handle, boost::hash<boost::uuids::uuid>> children;
+        for (const ModelObject& child : resources[i].children()) {
+          children.insert(child.handle());
+        }
+        for (const WorkspaceObject& source : resources[i].sources()) {
+          const Handle sourceHandle = source.handle();
+          if (auto it = resourceIndices.find(sourceHandle); it != resourceIndices.end()) {
+            resourceTargets[it->second].push_back(i);
+          } else if (children.find(sourceHandle) == children.end()) {
+            ++uses[i];
+            nonResourceTargets[sourceHandle].push_back(i);
+          }
+        }
+      }
+
+      std::vector<size_t> stack;
+      for (size_t i = 0; i < n; ++i) {
+        if (uses[i] > 0) {
+          used[i] = true;
+          stack.push_back(i);
+        }
+      }
+      while (!stack.empty()) {
+        const size_t i = stack.back();
+        stack.pop_back();
+        for (size_t target : resourceTargets[i]) {
+          ++uses[target];
+          if (!used[target]) {
+            used[target] = true;
+            stack.push_back(target);
+          }
+        }
+      }
+
+      // resources that stopped being used pass the loss on to the resources they point to
+      auto loseUse = [&uses, &used, &stack](size_t i) {
+        if (--uses[i] == 0 && used[i]) {
+          used[i] = false;
+          stack.push_back(i);
+        }
+      };
+
       IdfObjectVector removedObjects;
-      for (ResourceObject& resource : resources) {
+      for (size_t i = 0; i < n; ++i) {
         // test for initialized first in case earlier .remove() got this one already
-        if ((resource.initialized()) && (resource.nonResourceObjectUseCount(true) == 0)) {
-          openstudio::detail::concat_helper(removedObjects, resource.remove());
+        if (!resources[i].initialized() || used[i]) {
+          continue;
         }
+
+        std::vector<IdfObject> removed = resources[i].remove();
+        for (const IdfObject& object : removed) {
+          const Handle handle = object.handle();
+          if (auto it = resourceIndices.find(handle); it != resourceIndices.end()) {
+            // a used resource removed along with its parent
+            if (used[it->second]) {
+              used[it->second] = false;
+              stack.push_back(it->second);
+            }
+          } else if (auto it = nonResourceTargets.find(handle); it != nonResourceTargets.end()) {
+            for (size_t target : it->second) {
+              loseUse(target);
+            }
+          }
+        }
+        while (!stack.empty()) {
+          const size_t lost = stack.back();
+          stack.pop_back();
+          for (size_t target : resourceTargets[lost]) {
+            loseUse(target);
+          }
+        }
+
+        openstudio::detail::concat_helper(removedObjects, std::move(removed));
       }
       return removedObjects;
     }
@@ -1388,6 +1486,85 @@ namespace model {
       return removedObjects;
     }
 
+    std::map<Handle, ConstructionBase> Model_Impl::resolvedConstructions() const {
+      // resolve each space's default construction set chain once and prime the cache for everything it contains,
+      // so that the construction() calls below only walk the chain for surfaces outside of any space
+      if (m_resolvedDefaultConstructionsStale) {
+        m_resolvedDefaultConstructions.clear();
+        m_resolvedDefaultConstructionsStale = false;
+      }
+
+      for (const Space& space : model().getConcreteModelObjects<Space>()) {
+        const std::vector<std::pair<DefaultConstructionSet, int>> defaultConstructionSets =
+          space.getImpl<Space_Impl>()->defaultConstructionSetsWithSearchDistance();
+
+        auto resolve = [this, &space, &defaultConstructionSets](const PlanarSurface& planarSurface) {
+          if (!planarSurface.isConstructionDefaulted()) {
+            return;
+          }
+          ResolvedDefaultConstruction resolved{space.handle(), boost::none};
+          for (const auto& [defaultConstructionSet, searchDistance] : defaultConstructionSets) {
+            if (boost::optional<ConstructionBase> construction = defaultConstructionSet.getDefaultConstruction(planarSurface)) {
+              resolved.construction = std::make_pair(*construction, searchDistance);
+              break;
+            }
+          }
+          m_resolvedDefaultConstructions[planarSurface.handle()] = std::move(resolved);
+        };
+
+        for (const Surface& surface : space.surfaces()) {
+          resolve(surface);
+          for (const SubSurface& subSurface : surface.subSurfaces()) {
+            resolve(subSurface);
+          }
+        }
+        for (const ShadingSurfaceGroup& shadingSurfaceGroup : space.shadingSurfaceGroups()) {
+          for (const ShadingSurface& shadingSurface : shadingSurfaceGroup.shadingSurfaces()) {
+            resolve(shadingSurface);
+          }
+        }
+        for (const InteriorPartitionSurfaceGroup& interiorPartitionSurfaceGroup : space.interiorPartitionSurfaceGroups()) {
+          for (const InteriorPartitionSurface& interiorPartitionSurface : interiorPartitionSurfaceGroup.interiorPartitionSurfaces()) {
+            resolve(interiorPartitionSurface);
+          }
+        }
+      }
+
+      std::map<Handle, ConstructionBase> result;
+      for (const PlanarSurface& planarSurface : model().getModelObjects<PlanarSurface>()) {
+        // goes through construction() rather than the cache directly so Surface keeps its adjacent surface logic
+        if (boost::optional<ConstructionBase> construction = planarSurface.construction()) {
+          result.emplace(planarSurface.handle(), *construction);
+        }
+      }
+      return result;
+    }
+
+    boost::optional<std::pair<ConstructionBase, int>> Model_Impl::resolvedDefaultConstructionWithSearchDistance(const Space& space,
+                                                                                                              const PlanarSurface& planarSurface) const {
+      if (m_resolvedDefaultConstructionsStale) {
+        m_resolvedDefaultConstructions.clear();
+        m_resolvedDefaultConstructionsStale = false;
+      }
+
+      auto it = m_resolvedDefaultConstructions.find(planarSurface.handle());
+      if ((it != m_resolvedDefaultConstructions.end()) && (it->second.space == space.handle())) {
+        return it->second.construction;
+      }
+
+      ResolvedDefaultConstruction resolved{space.handle(), boost::none};
+      for (const auto& [defaultConstructionSet, searchDistance] : space.getImpl<Space_Impl>()->defaultConstructionSetsWithSearchDistance()) {
+        if (boost::optional<ConstructionBase> construction = defaultConstructionSet.getDefaultConstruction(planarSurface)) {
+          resolved.construction = std::make_pair(*construction, searchDistance);
+          break;
+        }
+      }
+
+      boost::optional<std::pair<ConstructionBase, int>> result = resolved.construction;
+      m_resolvedDefaultConstructions[planarSurface.handle()] = std::move(resolved);
+      return result;
+    }
+
     void Model_Impl::connect(const Model& m, ModelObject sourceObject, unsigned sourcePort, ModelObject targetObject, unsigned targetPort) {
       disconnect(sourceObject, sourcePort);
       disconnect(targetObject, targetPort);
@@ -1518,6 +1695,7 @@ namespace model {
     }
 
     void Model_Impl::clearCachedData() {
+      clearResolvedDefaultConstructions();
       Handle dummy;
       clearCachedBuilding(dummy);
       clearCachedFoundationKivaSettings(dummy);
@@ -1567,6 +1745,10 @@ namespace model {
       clearCachedExternalInterface(dummy);
     }
 
+    void Model_Impl::clearResolvedDefaultConstructions() {
+      m_resolvedDefaultConstructionsStale = true;
+    }
+
     void Model_Impl::clearCachedBuilding(const Handle&) {
       m_cachedBuilding.reset();
     }
@@ -2230,6 +2412,10 @@ namespace model {
     return getImpl<detail::Model_Impl>()->purgeUnusedResourceObjects(iddObjectType);
   }
 
+  std::map<Handle, ConstructionBase> Model::resolvedConstructions() const {
+    return getImpl<detail::Model_Impl>()->resolvedConstructions();
+  }
+
   void Model::addVersionObject() {
     getUniqueModelObject<Version>();
   }
@@ -37,6 +37,7 @@
 #include "../utilities/filetypes/WorkflowJSON.hpp"
 #include "../utilities/core/Assert.hpp"
 
+#include <map>
 #include <vector>
 
 namespace openstudio {
@@ -100,6 +101,7 @@ namespace model {
   class Schedule;
   class Node;
   class SpaceType;
+  class ConstructionBase;
 
   namespace detail {
     class Model_Impl;
@@ -638,6 +640,11 @@ namespace model {
    *  are not ResourceObjects, and these may be removed as well. */
     std::vector<openstudio::IdfObject> purgeUnusedResourceObjects(IddObjectType iddObjectType);
 
+    /** Returns the effective construction of every PlanarSurface in the model that has one, keyed by handle.
+   *  Default construction sets are resolved once per Space rather than once per surface. Results are shared
+   *  with PlanarSurface::construction(), which caches them until the model next changes. */
+    std::map<Handle, ConstructionBase> resolvedConstructions() const;
+
     // DLM@20110614: Kyle can you fill in here?
     /// Connects the sourcePort on the source ModelObject to the targetPort on the target ModelObject.
     void connect(ModelObject sourceObject, unsigned sourcePort, ModelObject targetObject, unsigned targetPort) const;
@@ -171,6 +171,9 @@
 // Ignore rawImpl, should that even be in the public interface?
 %ignore openstudio::model::Model::rawImpl;
 
+// ConstructionBase is not wrapped yet at this point, scripts can use PlanarSurface::construction which shares the same cache
+%ignore openstudio::model::Model::resolvedConstructions;
+
 namespace openstudio {
 namespace model {
 
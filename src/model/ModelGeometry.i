@@ -79,6 +79,9 @@
 %ignore openstudio::model::Space::getDefaultConstructionWithSearchDistance;
 %ignore openstudio::model::PlanarSurface::constructionWithSearchDistance;
 
+// Returns a reference into the cached vertices, use vertices() from the bindings
+%ignore openstudio::model::PlanarSurface::verticesView;
+
 namespace openstudio {
 namespace model {
 
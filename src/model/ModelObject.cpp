@@ -246,27 +246,8 @@ namespace model {
       std::string sqlName = name().get();
       boost::to_upper(sqlName);
 
-      // Query the InitializationSummary -> Component Sizing table to get
-      // the row names that contains information for this component.
-      const std::string rowsQuery = R"(
-      SELECT RowName FROM TabularDataWithStrings
-        WHERE ReportName = 'InitializationSummary'
-        AND ReportForString = 'Entire Facility'
-        AND TableName = 'Component Sizing Information'
-        AND Value = ?;)";
-
-      boost::optional<std::vector<std::string>> rowNames = model().sqlFile().get().execAndReturnVectorOfString(rowsQuery,
-                                                                                                               // bindArgs
-                                                                                                               sqlName);
-
-      // Warn if the query failed
-      if (!rowNames) {
-        LOG(Warn, "Could not find a component called '" + sqlName + "' in any rows of the InitializationSummary Component Sizing table.");
-        return boost::none;
-      }
-
-      // Query each row of the InitializationSummary -> Component Sizing table
-      // that contains this component to get the desired value.
+      // Look up the InitializationSummary -> Component Sizing table row
+      // that contains both this component and the desired value.
       std::string valueNameAndUnits = valueName + std::string(" [") + units + std::string("]");
       if (units.empty()) {
         valueNameAndUnits = valueName;
@@ -274,36 +255,8 @@ namespace model {
         valueNameAndUnits = valueName + std::string(" []");
       }
 
-      for (const std::string& rowName : rowNames.get()) {
-        const std::string rowCheckQuery = R"(
-        SELECT Value FROM TabularDataWithStrings
-          WHERE ReportName = 'InitializationSummary'
-          AND ReportForString = 'Entire Facility'
-          AND TableName = 'Component Sizing Information'
-          AND RowName = ?
-          AND Value = ?;)";
-        const boost::optional<std::string> rowValueName = model().sqlFile().get().execAndReturnFirstString(rowCheckQuery,
-                                                                                                           // bindArgs
-                                                                                                           rowName, valueNameAndUnits);
-        // Check if the query succeeded
-        if (!rowValueName) {
-          continue;
-        }
-        // This is the right row
-        const std::string valQuery = R"(
-        SELECT Value FROM TabularDataWithStrings
-          WHERE ReportName = 'InitializationSummary'
-          AND ReportForString = 'Entire Facility'
-          AND TableName = 'Component Sizing Information'
-          AND ColumnName='Value'
-          AND RowName = ?;)";
-        boost::optional<double> val = model().sqlFile().get().execAndReturnFirstDouble(valQuery,
-                                                                                       // bindArgs
-                                                                                       rowName);
-        // Check if the query succeeded and return if so
-        if (val) {
-          return val;
-        }
+      if (boost::optional<double> val = model().sqlFile()->initializationSummaryComponentSize(sqlName, valueNameAndUnits)) {
+        return val;
       }
 
       LOG(Debug, "The autosized value query for " + valueNameAndUnits + " of " + sqlName + " returned no value.");
@@ -337,16 +290,7 @@ namespace model {
         boost::replace_all(overrideCompType, "OS:", "");
       }
 
-      const std::string directQuery = R"sql(
-      SELECT Value FROM ComponentSizes
-        WHERE CompType = ?
-          AND CompName = ?
-          AND Description = ?
-          AND Units = ?;
-    )sql";
-      boost::optional<double> val = model().sqlFile().get().execAndReturnFirstDouble(directQuery,
-                                                                                     // bindArgs
-                                                                                     overrideCompType, sqlName, valueName, units);
+      boost::optional<double> val = model().sqlFile()->componentSize(overrideCompType, sqlName, valueName, units);
       if (!val) {
         LOG(Debug, fmt::format(R"sql(The direct query failed:
 SELECT Value FROM ComponentSizes
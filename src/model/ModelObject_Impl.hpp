@@ -227,7 +227,7 @@ namespace model {
       bool setSchedule(unsigned index, const std::string& className, const std::string& scheduleDisplayName, Schedule& schedule);
 
       /** For stuff that's plain missing from ComponentSizes table in E+, so getAutosizedValue can't work.
-        * This method is slower as it executes a lot more queries (an average of 10, versus 1 for getAutosizedValue) */
+        * Both look up the sizing results that the SqlFile reads once, on first use */
       boost::optional<double> getAutosizedValueFromInitializationSummary(const std::string& valueName, const std::string& units) const;
 
      private:
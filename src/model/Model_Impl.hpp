@@ -78,6 +78,7 @@
 #include "ClimateZones.hpp"
 #include "EnvironmentalImpactFactors.hpp"
 #include "ExternalInterface.hpp"
+#include "ConstructionBase.hpp"
 
 #include "../nano/nano_signal_slot.hpp"  // Signal-Slot replacement
 
@@ -88,7 +89,10 @@
 #include "../utilities/filetypes/WorkflowJSON.hpp"
 
 #include <boost/optional.hpp>
+#include <boost/functional/hash.hpp>
 
+#include <map>
+#include <unordered_map>
 #include <vector>
 
 namespace openstudio {
@@ -112,6 +116,8 @@ namespace model {
   class Schedule;
   class Node;
   class SpaceType;
+  class Space;
+  class PlanarSurface;
 
   namespace detail {
 
@@ -440,6 +446,13 @@ namespace model {
      *  are not ResourceObjects, and these may be removed as well. */
       virtual std::vector<openstudio::IdfObject> purgeUnusedResourceObjects(IddObjectType iddObjectType);
 
+      std::map<Handle, ConstructionBase> resolvedConstructions() const;
+
+      /** Returns space.getDefaultConstructionWithSearchDistance(planarSurface), resolving the default construction set
+     *  chain only if it has not been resolved for this surface since the model last changed. */
+      boost::optional<std::pair<ConstructionBase, int>> resolvedDefaultConstructionWithSearchDistance(const Space& space,
+                                                                                                      const PlanarSurface& planarSurface) const;
+
       void connect(const Model& model, ModelObject sourceObject, unsigned sourcePort, ModelObject targetObject, unsigned targetPort);
 
       void disconnect(ModelObject object, unsigned port);
@@ -533,8 +546,19 @@ namespace model {
       mutable boost::optional<EnvironmentalImpactFactors> m_cachedEnvironmentalImpactFactors;
       mutable boost::optional<ExternalInterface> m_cachedExternalInterface;
 
+      struct ResolvedDefaultConstruction
+      {
+        Handle space;
+        boost::optional<std::pair<ConstructionBase, int>> construction;
+      };
+
+      // keyed by PlanarSurface handle, cleared lazily after any change to the model
+      mutable std::unordered_map<Handle, ResolvedDefaultConstruction, boost::hash<boost::uuids::uuid>> m_resolvedDefaultConstructions;
+      mutable bool m_resolvedDefaultConstructionsStale = true;
+
       // private slots:
       void clearCachedData();
+      void clearResolvedDefaultConstructions();
       void clearCachedBuilding(const Handle& handle);
       void clearCachedFoundationKivaSettings(const Handle& handle);
       void clearCachedOutputControlFiles(const Handle& handle);
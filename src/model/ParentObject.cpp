@@ -43,7 +43,7 @@
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/ContainersMove.hpp"
 
-#include <deque>
+#include <unordered_set>
 
 namespace openstudio {
 namespace model {
@@ -129,98 +129,115 @@ namespace model {
     return getImpl<detail::ParentObject_Impl>()->allowableChildTypes();
   }
 
-  std::vector<ModelObject> getRecursiveChildren(const ParentObject& object, bool includeLifeCycleCostsAndAdditionalProperties,
-                                                bool includeUsedResources) {
-    std::set<Handle> resultSet;
-    std::pair<HandleSet::const_iterator, bool> insertResult;
-    resultSet.insert(object.handle());
-    std::vector<ModelObject> result;
-    result.push_back(object);
-
-    if (includeLifeCycleCostsAndAdditionalProperties) {
-      openstudio::detail::concat_helper(result, object.lifeCycleCosts());
-      if (object.hasAdditionalProperties()) {
-        result.push_back(object.additionalProperties());
+  namespace {
+
+    /** Breadth-first walk over the children (and optionally the resources) of a ModelObject. Each object is visited once, the
+     *  visited set is keyed on the object implementation so no Handle comparisons or ordered inserts are needed, and costs and
+     *  additional properties are read straight from the per-type source buckets of each newly reached object. */
+    class SubTreeTraversal
+    {
+     public:
+      SubTreeTraversal(bool includeLifeCycleCostsAndAdditionalProperties, bool includeUsedResources, bool followResources)
+        : m_includeLifeCycleCostsAndAdditionalProperties(includeLifeCycleCostsAndAdditionalProperties),
+          m_includeUsedResources(includeUsedResources),
+          m_followResources(followResources) {}
+
+      std::vector<ModelObject> collect(const ModelObject& object) {
+        m_visited.insert(object.getImpl<openstudio::detail::WorkspaceObject_Impl>().get());
+        add(object);
+
+        // flat queue, objects before head have already been expanded
+        std::size_t head = 0;
+        while (head < m_queue.size()) {
+          ModelObject current = m_queue[head++];
+          if (m_followResources) {
+            for (const ResourceObject& resource : current.resources()) {
+              if (visit(resource)) {
+                add(resource);
+              }
+            }
+          }
+          if (OptionalParentObject opo = current.optionalCast<ParentObject>()) {
+            for (const ModelObject& child : opo->children()) {
+              if (!m_includeUsedResources) {
+                auto _ro = child.optionalCast<ResourceObject>();
+                if (_ro && _ro->directUseCount() > 1) {
+                  continue;
+                }
+              }
+              if (visit(child)) {
+                add(child);
+              }
+            }
+          }
+        }
+
+        return std::move(m_result);
       }
-    }
 
-    std::deque<ParentObject> parents;
-    parents.push_back(object);
+      /** Same walk over resources only, each newly reached resource is expanded into its own sub tree (headed by the resource) with a
+       *  fresh traversal, since sub trees may share objects. m_visited only holds resources here. */
+      std::vector<std::vector<ModelObject>> collectResourceSubTrees(const ModelObject& object) {
+        std::vector<std::vector<ModelObject>> result;
+        m_queue.push_back(object);
+
+        std::size_t head = 0;
+        while (head < m_queue.size()) {
+          ModelObject current = m_queue[head++];
+          for (const ResourceObject& resource : current.resources()) {
+            if (visit(resource)) {
+              std::vector<ModelObject> subTree =
+                SubTreeTraversal(m_includeLifeCycleCostsAndAdditionalProperties, m_includeUsedResources, false).collect(resource);
+              m_queue.insert(m_queue.end(), subTree.begin(), subTree.end());
+              result.push_back(std::move(subTree));
+            }
+          }
+        }
 
-    while (!parents.empty()) {
-      ParentObject currentParent(parents[0]);
-      parents.pop_front();
+        return result;
+      }
 
-      // parent's costs have already been added
+     private:
+      bool visit(const ModelObject& object) {
+        return m_visited.insert(object.getImpl<openstudio::detail::WorkspaceObject_Impl>().get()).second;
+      }
 
-      for (const ModelObject& child : currentParent.children()) {
-        if (!includeUsedResources) {
-          auto _ro = child.optionalCast<ResourceObject>();
-          if (_ro && _ro->directUseCount() > 1) {
-            continue;
+      void add(const ModelObject& object) {
+        m_result.push_back(object);
+        if (m_includeLifeCycleCostsAndAdditionalProperties) {
+          for (const WorkspaceObject& cost : object.getSources(LifeCycleCost::iddObjectType())) {
+            m_result.push_back(cost.cast<ModelObject>());
           }
-        }
-        insertResult = resultSet.insert(child.handle());
-        if (insertResult.second) {
-          result.push_back(child);
-
-          if (includeLifeCycleCostsAndAdditionalProperties) {
-            openstudio::detail::concat_helper(result, child.lifeCycleCosts());
-            if (child.hasAdditionalProperties()) {
-              result.emplace_back(child.additionalProperties());
-            }
-          }
-
-          OptionalParentObject opo = child.optionalCast<ParentObject>();
-          if (opo) {
-            parents.push_back(*opo);
+          for (const WorkspaceObject& props : object.getSources(AdditionalProperties::iddObjectType())) {
+            m_result.push_back(props.cast<ModelObject>());
           }
         }
+        if (m_followResources || object.optionalCast<ParentObject>()) {
+          m_queue.push_back(object);
+        }
       }
-    }
 
-    return result;
+      bool m_includeLifeCycleCostsAndAdditionalProperties;
+      bool m_includeUsedResources;
+      bool m_followResources;
+      std::unordered_set<const openstudio::detail::WorkspaceObject_Impl*> m_visited;
+      std::vector<ModelObject> m_queue;
+      std::vector<ModelObject> m_result;
+    };
+
+  }  // namespace
+
+  std::vector<ModelObject> getRecursiveChildren(const ParentObject& object, bool includeLifeCycleCostsAndAdditionalProperties,
+                                                bool includeUsedResources) {
+    return SubTreeTraversal(includeLifeCycleCostsAndAdditionalProperties, includeUsedResources, false).collect(object);
   }
 
   std::vector<ModelObject> getRecursiveChildrenAndResources(const ModelObject& object) {
-    std::set<Handle> resultSet;
-    std::pair<HandleSet::const_iterator, bool> insertResult;
-    std::vector<ModelObject> result;
-    resultSet.insert(object.handle());
-    result.push_back(object);
-
-    std::deque<ModelObject> objectQueue;
-    objectQueue.push_back(object);
-
-    while (!objectQueue.empty()) {
-      ModelObject currentObject(objectQueue[0]);
-      objectQueue.pop_front();
-      // resources
-      for (const ResourceObject& resource : currentObject.resources()) {
-        insertResult = resultSet.insert(resource.handle());
-        if (insertResult.second) {
-          // new object
-          auto mo = resource.cast<ModelObject>();
-          result.push_back(mo);
-          objectQueue.push_back(mo);
-        }
-      }
-      // children
-      OptionalParentObject opo = currentObject.optionalCast<ParentObject>();
-      if (opo) {
-        ParentObject currentParent(*opo);
-        for (const ModelObject& child : currentParent.children()) {
-          insertResult = resultSet.insert(child.handle());
-          if (insertResult.second) {
-            // new object
-            result.push_back(child);
-            objectQueue.push_back(child);
-          }
-        }
-      }
-    }
+    return SubTreeTraversal(false, true, true).collect(object);
+  }
 
-    return result;
+  std::vector<std::vector<ModelObject>> getRecursiveResourceSubTrees(const ModelObject& object, bool includeComponentCostLineItems) {
+    return SubTreeTraversal(includeComponentCostLineItems, true, false).collectResourceSubTrees(object);
   }
 
 }  // namespace model
@@ -111,8 +111,13 @@ namespace model {
 
     /// get the vertices
     Point3dVector PlanarSurface_Impl::vertices() const {
+      return verticesView();
+    }
+
+    const Point3dVector& PlanarSurface_Impl::verticesView() const {
       if (!m_cachedVertices) {
         Point3dVector result;
+        result.reserve(numExtensibleGroups());
 
         for (const auto& group : extensibleGroups()) {
           OptionalDouble x = group.getDouble(0);
@@ -126,7 +131,7 @@ namespace model {
           }
         }
 
-        m_cachedVertices = result;
+        m_cachedVertices = std::move(result);
       }
 
       return m_cachedVertices.get();
@@ -134,6 +139,11 @@ namespace model {
 
     /// set the vertices
     bool PlanarSurface_Impl::setVertices(const std::vector<Point3d>& vertices) {
+      // clearing the extensible groups below resets the cache, so take a copy if we were handed our own verticesView
+      if (m_cachedVertices && (&vertices == &m_cachedVertices.get())) {
+        return setVertices(Point3dVector(vertices));
+      }
+
       unsigned n = vertices.size();
 
       if (n < 3) {
@@ -250,7 +260,7 @@ namespace model {
     /// get the outward normal
     Vector3d PlanarSurface_Impl::outwardNormal() const {
       if (!m_cachedOutwardNormal) {
-        Point3dVector vertices = this->vertices();
+        const Point3dVector& vertices = this->verticesView();
         m_cachedOutwardNormal = getOutwardNormal(vertices);
         if (!m_cachedOutwardNormal) {
           std::string surfaceNameMsg;
@@ -438,8 +448,8 @@ namespace model {
     }
 
     bool PlanarSurface_Impl::equalVertices(const PlanarSurface& other) const {
-      std::vector<Point3d> vertices1 = this->vertices();
-      std::vector<Point3d> vertices2 = other.vertices();
+      const std::vector<Point3d>& vertices1 = this->verticesView();
+      const std::vector<Point3d>& vertices2 = other.verticesView();
 
       boost::optional<PlanarSurfaceGroup> group;
 
@@ -459,7 +469,7 @@ namespace model {
     }
 
     bool PlanarSurface_Impl::reverseEqualVertices(const PlanarSurface& other) const {
-      std::vector<Point3d> vertices1 = this->vertices();
+      const std::vector<Point3d>& vertices1 = this->verticesView();
       std::vector<Point3d> vertices2 = other.vertices();
       std::reverse(vertices2.begin(), vertices2.end());
 
@@ -482,17 +492,18 @@ namespace model {
 
     Plane PlanarSurface_Impl::plane() const {
       if (!m_cachedPlane) {
-        m_cachedPlane = Plane(this->vertices());
+        m_cachedPlane = Plane(this->verticesView());
       }
       return m_cachedPlane.get();
     }
 
     std::vector<std::vector<Point3d>> PlanarSurface_Impl::triangulation() const {
       if (m_cachedTriangulation.empty()) {
-        Transformation faceTransformation = Transformation::alignFace(this->vertices());
+        const std::vector<Point3d>& vertices = this->verticesView();
+        Transformation faceTransformation = Transformation::alignFace(vertices);
         Transformation faceTransformationInverse = faceTransformation.inverse();
 
-        std::vector<Point3d> faceVertices = faceTransformationInverse * this->vertices();
+        std::vector<Point3d> faceVertices = faceTransformationInverse * vertices;
         std::reverse(faceVertices.begin(), faceVertices.end());
 
         std::vector<std::vector<Point3d>> faceHoles;
@@ -500,7 +511,7 @@ namespace model {
           OptionalPlanarSurface surface = child.optionalCast<PlanarSurface>();
           if (surface) {
             if (surface->subtractFromGrossArea()) {
-              std::vector<Point3d> holeVertices = faceTransformationInverse * surface->vertices();
+              std::vector<Point3d> holeVertices = faceTransformationInverse * surface->verticesView();
               std::reverse(holeVertices.begin(), holeVertices.end());
               faceHoles.push_back(holeVertices);
             }
@@ -518,7 +529,7 @@ namespace model {
     }
 
     Point3d PlanarSurface_Impl::centroid() const {
-      boost::optional<Point3d> result = getCentroid(this->vertices());
+      boost::optional<Point3d> result = getCentroid(this->verticesView());
       OS_ASSERT(result);
       return *result;
     }
@@ -620,6 +631,10 @@ namespace model {
     return getImpl<detail::PlanarSurface_Impl>()->vertices();
   }
 
+  const Point3dVector& PlanarSurface::verticesView() const {
+    return getImpl<detail::PlanarSurface_Impl>()->verticesView();
+  }
+
   /// set the vertices
   bool PlanarSurface::setVertices(const std::vector<Point3d>& vertices) {
     return getImpl<detail::PlanarSurface_Impl>()->setVertices(vertices);
@@ -113,6 +113,10 @@ namespace model {
     /// Returns the vertices.
     std::vector<Point3d> vertices() const;
 
+    /** Returns a reference to the cached vertices without copying them. The reference stays valid until the vertices
+     *  of this surface are changed or the surface is removed from the model, prefer vertices() when holding on to the result. */
+    const std::vector<Point3d>& verticesView() const;
+
     //@}
     /** @name Setters */
     //@{
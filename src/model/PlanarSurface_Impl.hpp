@@ -101,6 +101,8 @@ namespace model {
 
       std::vector<Point3d> vertices() const;
 
+      const std::vector<Point3d>& verticesView() const;
+
       //@}
       /** @name Setters */
 
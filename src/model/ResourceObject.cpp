@@ -148,29 +148,5 @@ namespace model {
     return result;
   }
 
-  std::vector<std::vector<ModelObject>> getRecursiveResourceSubTrees(const ModelObject& object, bool includeComponentCostLineItems) {
-    std::set<Handle> resultSet;
-    std::pair<HandleSet::const_iterator, bool> insertResult;
-    std::vector<std::vector<ModelObject>> result;
-
-    std::deque<ModelObject> objectQueue;
-    objectQueue.push_back(object);
-
-    while (!objectQueue.empty()) {
-      ModelObject currentObject(objectQueue[0]);
-      objectQueue.pop_front();
-      for (const ResourceObject& resource : currentObject.resources()) {
-        insertResult = resultSet.insert(resource.handle());
-        if (insertResult.second) {
-          std::vector<ModelObject> subTree = getRecursiveChildren(resource, includeComponentCostLineItems);
-          objectQueue.insert(objectQueue.end(), subTree.begin(), subTree.end());
-          result.push_back(subTree);
-        }
-      }
-    }
-
-    return result;
-  }
-
 }  // namespace model
 }  // namespace openstudio
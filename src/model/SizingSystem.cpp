@@ -937,14 +937,7 @@ namespace model {
       }
 
       // Note JM 2018-09-10: It's not in the TabularDataWithStrings, so I look in the ComponentSizes
-      std::string valQuery = R"(
-        SELECT Value FROM ComponentSizes
-          WHERE CompType = 'AirLoopHVAC'
-          AND Description = 'User Heating Air Flow Ratio'
-          AND Units = ''
-          AND CompName = ?;)";
-
-      boost::optional<double> val = model().sqlFile().get().execAndReturnFirstDouble(valQuery, sqlName);
+      boost::optional<double> val = model().sqlFile()->componentSize("AirLoopHVAC", sqlName, "User Heating Air Flow Ratio", "");
       // Check if the query succeeded
       if (val) {
         result = val.get();
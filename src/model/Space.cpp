@@ -235,12 +235,12 @@ namespace model {
       Transformation childTransformation = transformation.inverse() * oldTransformation;
 
       for (Surface& surface : this->surfaces()) {
-        bool test = surface.setVertices(childTransformation * surface.vertices());
+        bool test = surface.setVertices(childTransformation * surface.verticesView());
         if (!test) {
           LOG(Error, "Could not transform vertices for Surface '" << surface.name().get() << "'.");
         }
         for (SubSurface& subSurface : surface.subSurfaces()) {
-          test = subSurface.setVertices(childTransformation * subSurface.vertices());
+          test = subSurface.setVertices(childTransformation * subSurface.verticesView());
           if (!test) {
             LOG(Error, "Could not transform vertices for SubSurface '" << subSurface.name().get() << "'.");
           }
@@ -513,7 +513,12 @@ namespace model {
     }
 
     boost::optional<std::pair<ConstructionBase, int>> Space_Impl::getDefaultConstructionWithSearchDistance(const PlanarSurface& planarSurface) const {
-      boost::optional<ConstructionBase> result;
+      // the model caches the result per surface until something in the model changes
+      return this->model().getImpl<Model_Impl>()->resolvedDefaultConstructionWithSearchDistance(getObject<Space>(), planarSurface);
+    }
+
+    std::vector<std::pair<DefaultConstructionSet, int>> Space_Impl::defaultConstructionSetsWithSearchDistance() const {
+      std::vector<std::pair<DefaultConstructionSet, int>> result;
       boost::optional<DefaultConstructionSet> defaultConstructionSet;
       boost::optional<SpaceType> spaceType;
       boost::optional<BuildingStory> buildingStory;
@@ -522,10 +527,7 @@ namespace model {
       // first check this object
       defaultConstructionSet = this->defaultConstructionSet();
       if (defaultConstructionSet) {
-        result = defaultConstructionSet->getDefaultConstruction(planarSurface);
-        if (result) {
-          return std::make_pair(*result, 1);
-        }
+        result.emplace_back(*defaultConstructionSet, 1);
       }
 
       // then check space type
@@ -533,10 +535,7 @@ namespace model {
       if (spaceType && !this->isSpaceTypeDefaulted()) {
         defaultConstructionSet = spaceType->defaultConstructionSet();
         if (defaultConstructionSet) {
-          result = defaultConstructionSet->getDefaultConstruction(planarSurface);
-          if (result) {
-            return std::make_pair(*result, 2);
-          }
+          result.emplace_back(*defaultConstructionSet, 2);
         }
       }
 
@@ -545,10 +544,7 @@ namespace model {
       if (buildingStory) {
         defaultConstructionSet = buildingStory->defaultConstructionSet();
         if (defaultConstructionSet) {
-          result = defaultConstructionSet->getDefaultConstruction(planarSurface);
-          if (result) {
-            return std::make_pair(*result, 3);
-          }
+          result.emplace_back(*defaultConstructionSet, 3);
         }
       }
 
@@ -557,10 +553,7 @@ namespace model {
       if (building) {
         defaultConstructionSet = building->defaultConstructionSet();
         if (defaultConstructionSet) {
-          result = defaultConstructionSet->getDefaultConstruction(planarSurface);
-          if (result) {
-            return std::make_pair(*result, 4);
-          }
+          result.emplace_back(*defaultConstructionSet, 4);
         }
 
         // then check building's space type
@@ -568,15 +561,12 @@ namespace model {
         if (spaceType) {
           defaultConstructionSet = spaceType->defaultConstructionSet();
           if (defaultConstructionSet) {
-            result = defaultConstructionSet->getDefaultConstruction(planarSurface);
-            if (result) {
-              return std::make_pair(*result, 5);
-            }
+            result.emplace_back(*defaultConstructionSet, 5);
           }
         }
       }
 
-      return boost::none;
+      return result;
     }
 
     bool Space_Impl::setDefaultConstructionSet(const DefaultConstructionSet& defaultConstructionSet) {
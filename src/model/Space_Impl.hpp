@@ -211,6 +211,9 @@ namespace model {
       boost::optional<ConstructionBase> getDefaultConstruction(const PlanarSurface& planarSurface) const;
       boost::optional<std::pair<ConstructionBase, int>> getDefaultConstructionWithSearchDistance(const PlanarSurface& planarSurface) const;
 
+      /// Returns the default construction sets searched by getDefaultConstruction, in order, with their search distances.
+      std::vector<std::pair<DefaultConstructionSet, int>> defaultConstructionSetsWithSearchDistance() const;
+
       /// Sets the default construction set for this space directly.
       bool setDefaultConstructionSet(const DefaultConstructionSet& defaultConstructionSet);
 
@@ -65,6 +65,7 @@
 
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/Compare.hpp"
+#include "../utilities/core/ParallelFor.hpp"
 #include "../utilities/geometry/Point3d.hpp"
 #include "../utilities/geometry/Plane.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
@@ -322,20 +323,49 @@ namespace model {
     }
   }
 
-  void makeGeometries(const PlanarSurface& planarSurface, std::vector<ThreeGeometry>& geometries, std::vector<ThreeUserData>& userDatas,
-                      bool triangulateSurfaces) {
-    std::string name = planarSurface.nameString();
-    boost::optional<Surface> surface = planarSurface.optionalCast<Surface>();
-    boost::optional<PlanarSurfaceGroup> planarSurfaceGroup = planarSurface.planarSurfaceGroup();
+  // check if the adjacent surface is truly adjacent
+  // this controls display only, not energy model
+  void updateCoincidentWithOutsideObject(ThreeUserData& userData, const PlanarSurface& planarSurface,
+                                         const Transformation& buildingTransformation) {
+    if (!userData.outsideBoundaryConditionObjectHandle().empty()) {
+
+      UUID adjacentHandle = toUUID(fromThreeUUID(userData.outsideBoundaryConditionObjectHandle()));
+      boost::optional<PlanarSurface> adjacentPlanarSurface = planarSurface.model().getModelObject<PlanarSurface>(adjacentHandle);
+      OS_ASSERT(adjacentPlanarSurface);
 
-    // get the transformation to site coordinates
-    Transformation buildingTransformation;
-    if (planarSurfaceGroup) {
-      buildingTransformation = planarSurfaceGroup->buildingTransformation();
+      Transformation otherBuildingTransformation;
+      if (adjacentPlanarSurface->planarSurfaceGroup()) {
+        otherBuildingTransformation = adjacentPlanarSurface->planarSurfaceGroup()->buildingTransformation();
+      }
+
+      Point3dVector otherVertices = otherBuildingTransformation * adjacentPlanarSurface->verticesView();
+      if (circularEqual(buildingTransformation * planarSurface.verticesView(), reverse(otherVertices))) {
+        userData.setCoincidentWithOutsideObject(true);
+      } else {
+        userData.setCoincidentWithOutsideObject(false);
+      }
     }
+  }
+
+  // Runs func and returns what it logs on the current thread at Warn and above. The translator's sink only listens to the calling
+  // thread, so this is how messages logged on worker threads get back to it
+  template <typename Func>
+  std::vector<LogMessage> logMessagesOnThisThread(Func&& func) {
+    StringStreamLogSink sink;
+    // The sink listens to every thread until it is filtered, drop whatever it caught in between
+    sink.disable();
+    sink.setLogLevel(Warn);
+    sink.setThreadId(std::this_thread::get_id());
+    sink.resetStringStream();
+    sink.enable();
+    func();
+    return sink.logMessages();
+  }
 
-    // get the vertices
-    Point3dVector vertices = planarSurface.vertices();
+  // Triangulates a surface around its sub surfaces (or keeps it as a single face) and welds the resulting vertices.
+  // This only works on plain geometry, in the coordinates of the planar surface group, so it can run on any thread
+  void triangulatePlanarSurface(const Point3dVector& vertices, const Point3dVectorVector& subSurfaceVertices, bool triangulateSurfaces,
+                                Point3dVector& allVertices, std::vector<size_t>& faceIndices, bool& failed) {
     Transformation t = Transformation::alignFace(vertices);
     //Transformation r = t.rotationMatrix();
     Transformation tInv = t.inverse();
@@ -343,27 +373,25 @@ namespace model {
 
     // get vertices of all sub surfaces
     Point3dVectorVector faceSubVertices;
-    if (surface) {
-      for (const auto& subSurface : surface->subSurfaces()) {
-        faceSubVertices.push_back(reverse(tInv * subSurface.vertices()));
-      }
+    faceSubVertices.reserve(subSurfaceVertices.size());
+    for (const auto& subVertices : subSurfaceVertices) {
+      faceSubVertices.push_back(reverse(tInv * subVertices));
     }
 
     Point3dVectorVector finalFaceVertices;
     if (triangulateSurfaces) {
       finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
       if (finalFaceVertices.empty()) {
-        LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << name << " with " << faceSubVertices.size() << " sub surfaces");
+        failed = true;
         return;
       }
     } else {
       finalFaceVertices.push_back(faceVertices);
     }
 
-    Point3dVector allVertices;
-    std::vector<size_t> faceIndices;
     for (const auto& finalFaceVerts : finalFaceVertices) {
-      Point3dVector finalVerts = buildingTransformation * t * finalFaceVerts;
+      // Welding before the building transformation is the same as after, it is rigid
+      Point3dVector finalVerts = t * finalFaceVerts;
       //normal = buildingTransformation.rotationMatrix*r*z
 
       // https://github.com/mrdoob/three.js/wiki/JSON-Model-format-3
@@ -390,37 +418,6 @@ namespace model {
       // convert to 1 based indices
       //face_indices.each_index {|i| face_indices[i] = face_indices[i] + 1}
     }
-
-    ThreeGeometryData geometryData(toThreeVector(allVertices), faceIndices);
-
-    ThreeGeometry geometry(toThreeUUID(toString(planarSurface.handle())), "Geometry", geometryData);
-    geometries.push_back(geometry);
-
-    ThreeUserData userData;
-    updateUserData(userData, planarSurface);
-
-    // check if the adjacent surface is truly adjacent
-    // this controls display only, not energy model
-    if (!userData.outsideBoundaryConditionObjectHandle().empty()) {
-
-      UUID adjacentHandle = toUUID(fromThreeUUID(userData.outsideBoundaryConditionObjectHandle()));
-      boost::optional<PlanarSurface> adjacentPlanarSurface = planarSurface.model().getModelObject<PlanarSurface>(adjacentHandle);
-      OS_ASSERT(adjacentPlanarSurface);
-
-      Transformation otherBuildingTransformation;
-      if (adjacentPlanarSurface->planarSurfaceGroup()) {
-        otherBuildingTransformation = adjacentPlanarSurface->planarSurfaceGroup()->buildingTransformation();
-      }
-
-      Point3dVector otherVertices = otherBuildingTransformation * adjacentPlanarSurface->vertices();
-      if (circularEqual(buildingTransformation * vertices, reverse(otherVertices))) {
-        userData.setCoincidentWithOutsideObject(true);
-      } else {
-        userData.setCoincidentWithOutsideObject(false);
-      }
-    }
-
-    userDatas.push_back(userData);
   }
 
   ThreeJSForwardTranslator::ThreeJSForwardTranslator() {
@@ -482,29 +479,94 @@ namespace model {
     std::vector<PlanarSurface>::size_type N = planarSurfaces.size() + planarSurfaceGroups.size() + buildingStories.size() + buildingUnits.size()
                                               + thermalZones.size() + spaceTypes.size() + defaultConstructionSets.size() + airLoopHVACs.size() + 1;
 
-    // loop over all surfaces
-    for (const auto& planarSurface : planarSurfaces) {
-      std::vector<ThreeGeometry> geometries;
-      std::vector<ThreeUserData> userDatas;
-      makeGeometries(planarSurface, geometries, userDatas, triangulateSurfaces);
-      OS_ASSERT(geometries.size() == userDatas.size());
+    // Gather everything that needs the model on this thread, and find the surfaces whose cached triangulation is still good
+    const size_t nPlanarSurfaces = planarSurfaces.size();
+    std::vector<SurfaceTriangulation> triangulations(nPlanarSurfaces);
+    std::vector<bool> needsTriangulation(nPlanarSurfaces, true);
+    std::vector<Transformation> buildingTransformations(nPlanarSurfaces);
+    std::vector<ThreeUserData> userDatas(nPlanarSurfaces);
+    std::vector<std::string> geometryIds(nPlanarSurfaces);
+
+    for (size_t i = 0; i < nPlanarSurfaces; ++i) {
+      const PlanarSurface& planarSurface = planarSurfaces[i];
+      geometryIds[i] = toThreeUUID(toString(planarSurface.handle()));
+
+      // get the transformation to site coordinates
+      if (boost::optional<PlanarSurfaceGroup> planarSurfaceGroup = planarSurface.planarSurfaceGroup()) {
+        buildingTransformations[i] = planarSurfaceGroup->buildingTransformation();
+      }
+
+      SurfaceTriangulation& triangulation = triangulations[i];
+      triangulation.vertices = planarSurface.verticesView();
+      if (boost::optional<Surface> surface = planarSurface.optionalCast<Surface>()) {
+        for (const auto& subSurface : surface->subSurfaces()) {
+          triangulation.subSurfaceVertices.push_back(subSurface.verticesView());
+        }
+      }
+      triangulation.triangulateSurfaces = triangulateSurfaces;
+
+      auto it = m_triangulationCache.find(planarSurface.handle());
+      if (it != m_triangulationCache.end() && it->second.triangulateSurfaces == triangulateSurfaces && it->second.vertices == triangulation.vertices
+          && it->second.subSurfaceVertices == triangulation.subSurfaceVertices) {
+        triangulation = std::move(it->second);
+        needsTriangulation[i] = false;
+      }
 
-      size_t n = geometries.size();
-      for (size_t i = 0; i < n; ++i) {
+      updateUserData(userDatas[i], planarSurface);
+      updateCoincidentWithOutsideObject(userDatas[i], planarSurface, buildingTransformations[i]);
 
-        allGeometries.push_back(geometries[i]);
+      n += 1;
+      updatePercentage(100.0 * n / N);
+    }
 
+    // Triangulate and build the geometries, each surface only writes its own slot
+    const std::thread::id callingThreadId = std::this_thread::get_id();
+    std::vector<boost::optional<ThreeGeometry>> geometries(nPlanarSurfaces);
+    std::vector<char> alreadyLogged(nPlanarSurfaces, 0);
+    parallelFor(nPlanarSurfaces, [&](size_t i) {
+      SurfaceTriangulation& triangulation = triangulations[i];
+      if (needsTriangulation[i]) {
+        triangulation.logMessages = logMessagesOnThisThread([&]() {
+          triangulatePlanarSurface(triangulation.vertices, triangulation.subSurfaceVertices, triangulateSurfaces, triangulation.allVertices,
+                                   triangulation.faceIndices, triangulation.failed);
+        });
+        // parallelFor runs inline when there is a single thread or surface, m_logSink has seen those messages already
+        alreadyLogged[i] = (std::this_thread::get_id() == callingThreadId);
+      }
+      if (!triangulation.failed) {
+        ThreeGeometryData geometryData(toThreeVector(buildingTransformations[i] * triangulation.allVertices), triangulation.faceIndices);
+        geometries[i] = ThreeGeometry(geometryIds[i], "Geometry", geometryData);
+      }
+    });
+
+    // Back on this thread, build the scene in surface order and keep the triangulations for the next call
+    std::map<UUID, SurfaceTriangulation> triangulationCache;
+    allGeometries.reserve(nPlanarSurfaces);
+    sceneChildren.reserve(nPlanarSurfaces);
+    for (size_t i = 0; i < nPlanarSurfaces; ++i) {
+      if (!alreadyLogged[i]) {
+        for (const auto& logMessage : triangulations[i].logMessages) {
+          LOG_FREE(logMessage.logLevel(), logMessage.logChannel(), logMessage.logMessage());
+        }
+      }
+      if (!geometries[i]) {
+        LOG_FREE(Error, "modelToThreeJS",
+                 "Failed to triangulate surface " << planarSurfaces[i].nameString() << " with " << triangulations[i].subSurfaceVertices.size()
+                                                  << " sub surfaces");
+      } else {
         std::string thisUUID(toThreeUUID(toString(createUUID())));
         std::string thisName(userDatas[i].name());
         std::string thisMaterialId = getThreeMaterialId(userDatas[i].surfaceTypeMaterialName(), materialMap);
 
-        ThreeSceneChild sceneChild(thisUUID, thisName, "Mesh", geometries[i].uuid(), thisMaterialId, userDatas[i]);
+        ThreeSceneChild sceneChild(thisUUID, thisName, "Mesh", geometries[i]->uuid(), thisMaterialId, userDatas[i]);
         sceneChildren.push_back(sceneChild);
+
+        allGeometries.push_back(std::move(*geometries[i]));
       }
 
-      n += 1;
-      updatePercentage(100.0 * n / N);
+      triangulationCache.emplace(planarSurfaces[i].handle(), std::move(triangulations[i]));
     }
+    m_triangulationCache = std::move(triangulationCache);
 
     ThreeSceneObject sceneObject(toThreeUUID(toString(openstudio::createUUID())), sceneChildren);
 
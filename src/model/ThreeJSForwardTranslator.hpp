@@ -37,6 +37,9 @@
 #include "../utilities/geometry/ThreeJS.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
+#include "../utilities/core/UUID.hpp"
+
+#include <map>
 
 namespace openstudio {
 namespace model {
@@ -55,6 +58,8 @@ namespace model {
     /// Convert an OpenStudio Model to ThreeJS format
     /// Triangulate surfaces if the ThreeJS representation will be used for display
     /// Do not triangulate surfaces if the ThreeJs representation will be translated back to a model
+    /// Surfaces are triangulated in parallel. The triangulations are kept on the translator and reused on the next call for
+    /// surfaces whose vertices and sub surface vertices did not change, so keep the same translator around to re-translate after edits
     ThreeScene modelToThreeJS(const Model& model, bool triangulateSurfaces);
     ThreeScene modelToThreeJS(const Model& model, bool triangulateSurfaces, std::function<void(double)> updatePercentage);
 
@@ -67,7 +72,23 @@ namespace model {
    private:
     REGISTER_LOGGER("openstudio.model.ThreeJSForwardTranslator");
 
+    // Triangulation of a planar surface, in the coordinates of its planar surface group, along with the inputs it was computed from
+    struct SurfaceTriangulation
+    {
+      Point3dVector vertices;
+      Point3dVectorVector subSurfaceVertices;
+      bool triangulateSurfaces = true;
+
+      Point3dVector allVertices;
+      std::vector<size_t> faceIndices;
+      bool failed = false;
+      // What triangulating logged, replayed on the calling thread each time the triangulation is used
+      std::vector<LogMessage> logMessages;
+    };
+
     StringStreamLogSink m_logSink;
+
+    std::map<UUID, SurfaceTriangulation> m_triangulationCache;
   };
 
 }  // namespace model
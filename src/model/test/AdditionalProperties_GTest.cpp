@@ -46,6 +46,7 @@
 #include "../StandardOpaqueMaterial_Impl.hpp"
 #include "../Lights.hpp"
 #include "../LightsDefinition.hpp"
+#include "../Space.hpp"
 
 #include <utilities/idd/OS_AdditionalProperties_FieldEnums.hxx>
 
@@ -299,6 +300,31 @@ TEST_F(ModelFixture, AdditionalProperties_ChildClone) {
   EXPECT_EQ(1u, model.getConcreteModelObjects<AdditionalProperties>().size());
 }
 
+// check that recursive children pick up the properties of every object in the tree
+TEST_F(ModelFixture, AdditionalProperties_RecursiveChildren) {
+  Model model;
+  Space space(model);
+  LightsDefinition def(model);
+  Lights lights(def);
+  EXPECT_TRUE(lights.setSpace(space));
+  AdditionalProperties spaceProps = space.additionalProperties();
+  AdditionalProperties lightsProps = lights.additionalProperties();
+
+  std::vector<ModelObject> children = getRecursiveChildren(space);
+  std::vector<ModelObject> childrenAndProps = getRecursiveChildren(space, true);
+  EXPECT_EQ(children.size() + 2u, childrenAndProps.size());
+  ASSERT_FALSE(childrenAndProps.empty());
+  EXPECT_EQ(space, childrenAndProps[0]);
+  EXPECT_NE(std::find(children.begin(), children.end(), lights), children.end());
+  EXPECT_NE(std::find(childrenAndProps.begin(), childrenAndProps.end(), spaceProps), childrenAndProps.end());
+  EXPECT_NE(std::find(childrenAndProps.begin(), childrenAndProps.end(), lightsProps), childrenAndProps.end());
+  EXPECT_EQ(std::find(childrenAndProps.begin(), childrenAndProps.end(), def), childrenAndProps.end());
+
+  // the definition is reached through resources
+  std::vector<ModelObject> childrenAndResources = getRecursiveChildrenAndResources(space);
+  EXPECT_NE(std::find(childrenAndResources.begin(), childrenAndResources.end(), def), childrenAndResources.end());
+}
+
 // check that can't add properties to a properties
 TEST_F(ModelFixture, AdditionalProperties_AdditionalProperties2) {
   Model model;
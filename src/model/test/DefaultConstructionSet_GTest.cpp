@@ -49,6 +49,8 @@
 #include "../ShadingSurface.hpp"
 #include "../ShadingSurfaceGroup.hpp"
 #include "../Space.hpp"
+#include "../BuildingStory.hpp"
+#include "../Building.hpp"
 
 #include "../../utilities/geometry/Point3d.hpp"
 
@@ -585,3 +587,112 @@ TEST_F(ModelFixture, DefaultConstructionSet_CloneBadName) {
   clone = defaultSurfaceConstructions.clone(model);
   EXPECT_EQ("*H.a.r.d.e.s.t*^\\1|-|8/_#($name$)?# 2", clone.name().get());
 }
+
+TEST_F(ModelFixture, DefaultConstructionSet_ResolvedConstructions) {
+  Model model;
+
+  Space space(model);
+  Space otherSpace(model);
+  BuildingStory buildingStory(model);
+  EXPECT_TRUE(space.setBuildingStory(buildingStory));
+
+  Point3dVector points{
+    {0, 0, 1},
+    {0, 0, 0},
+    {1, 0, 0},
+    {1, 0, 1},
+  };
+  Surface surface(points, model);
+  EXPECT_TRUE(surface.setSpace(space));
+  EXPECT_TRUE(surface.setSurfaceType("Wall"));
+  EXPECT_TRUE(surface.setOutsideBoundaryCondition("Outdoors"));
+
+  Point3dVector subPoints{
+    {0.25, 0, 0.75},
+    {0.25, 0, 0.25},
+    {0.75, 0, 0.25},
+    {0.75, 0, 0.75},
+  };
+  SubSurface subSurface(subPoints, model);
+  EXPECT_TRUE(subSurface.setSurface(surface));
+  EXPECT_TRUE(subSurface.setSubSurfaceType("FixedWindow"));
+
+  Construction buildingWall(model);
+  Construction storyWall(model);
+  Construction spaceWall(model);
+  Construction window(model);
+
+  DefaultConstructionSet buildingSet(model);
+  DefaultSurfaceConstructions buildingSurfaces(model);
+  DefaultSubSurfaceConstructions buildingSubSurfaces(model);
+  EXPECT_TRUE(buildingSurfaces.setWallConstruction(buildingWall));
+  EXPECT_TRUE(buildingSubSurfaces.setFixedWindowConstruction(window));
+  EXPECT_TRUE(buildingSet.setDefaultExteriorSurfaceConstructions(buildingSurfaces));
+  EXPECT_TRUE(buildingSet.setDefaultExteriorSubSurfaceConstructions(buildingSubSurfaces));
+
+  EXPECT_FALSE(surface.construction());
+  EXPECT_TRUE(model.resolvedConstructions().empty());
+
+  // the cache has to notice the building picking up a default construction set
+  EXPECT_TRUE(model.getUniqueModelObject<Building>().setDefaultConstructionSet(buildingSet));
+  ASSERT_TRUE(surface.construction());
+  EXPECT_EQ(buildingWall.handle(), surface.construction()->handle());
+  ASSERT_TRUE(surface.constructionWithSearchDistance());
+  EXPECT_EQ(4, surface.constructionWithSearchDistance()->second);
+  ASSERT_TRUE(subSurface.construction());
+  EXPECT_EQ(window.handle(), subSurface.construction()->handle());
+
+  // story assignment and story default construction set
+  DefaultConstructionSet storySet(model);
+  DefaultSurfaceConstructions storySurfaces(model);
+  EXPECT_TRUE(storySet.setDefaultExteriorSurfaceConstructions(storySurfaces));
+  EXPECT_TRUE(buildingStory.setDefaultConstructionSet(storySet));
+  ASSERT_TRUE(surface.construction());
+  EXPECT_EQ(buildingWall.handle(), surface.construction()->handle());
+  EXPECT_TRUE(storySurfaces.setWallConstruction(storyWall));
+  ASSERT_TRUE(surface.construction());
+  EXPECT_EQ(storyWall.handle(), surface.construction()->handle());
+  space.resetBuildingStory();
+  ASSERT_TRUE(surface.construction());
+  EXPECT_EQ(buildingWall.handle(), surface.construction()->handle());
+
+  // space default construction set takes precedence
+  DefaultConstructionSet spaceSet(model);
+  DefaultSurfaceConstructions spaceSurfaces(model);
+  EXPECT_TRUE(spaceSurfaces.setWallConstruction(spaceWall));
+  EXPECT_TRUE(spaceSet.setDefaultExteriorSurfaceConstructions(spaceSurfaces));
+  EXPECT_TRUE(space.setDefaultConstructionSet(spaceSet));
+  ASSERT_TRUE(surface.construction());
+  EXPECT_EQ(spaceWall.handle(), surface.construction()->handle());
+  ASSERT_TRUE(subSurface.construction());
+  EXPECT_EQ(window.handle(), subSurface.construction()->handle());
+
+  std::map<Handle, ConstructionBase> resolved = model.resolvedConstructions();
+  EXPECT_EQ(2u, resolved.size());
+  ASSERT_EQ(1u, resolved.count(surface.handle()));
+  EXPECT_EQ(spaceWall.handle(), resolved.at(surface.handle()).handle());
+  ASSERT_EQ(1u, resolved.count(subSurface.handle()));
+  EXPECT_EQ(window.handle(), resolved.at(subSurface.handle()).handle());
+
+  // surface type and boundary condition
+  EXPECT_TRUE(surface.setOutsideBoundaryCondition("Ground"));
+  EXPECT_FALSE(surface.construction());
+  EXPECT_TRUE(surface.setOutsideBoundaryCondition("Outdoors"));
+  EXPECT_TRUE(surface.setSurfaceType("Floor"));
+  EXPECT_FALSE(surface.construction());
+  EXPECT_TRUE(surface.setSurfaceType("Wall"));
+  ASSERT_TRUE(surface.construction());
+  EXPECT_EQ(spaceWall.handle(), surface.construction()->handle());
+
+  // moving the surface to another space
+  EXPECT_TRUE(surface.setSpace(otherSpace));
+  ASSERT_TRUE(surface.construction());
+  EXPECT_EQ(buildingWall.handle(), surface.construction()->handle());
+
+  // removing the construction the surface resolved to
+  buildingWall.remove();
+  EXPECT_FALSE(surface.construction());
+  resolved = model.resolvedConstructions();
+  EXPECT_EQ(0u, resolved.count(surface.handle()));
+  EXPECT_EQ(1u, resolved.count(subSurface.handle()));
+}
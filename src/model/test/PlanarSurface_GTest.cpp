@@ -32,6 +32,7 @@
 #include "ModelFixture.hpp"
 #include "../PlanarSurface.hpp"
 #include "../PlanarSurface_Impl.hpp"
+#include "../Surface.hpp"
 
 #include "../../utilities/units/QuantityFactory.hpp"
 #include "../../utilities/units/QuantityConverter.hpp"
@@ -85,3 +86,23 @@ TEST_F(ModelFixture, PlanarSurface_FilmResistanceConversions) {
   EXPECT_EQ("s^3*K/kg", qc->standardUnitsString());
   EXPECT_NEAR(qc->value(), PlanarSurface::filmResistance(FilmResistanceType::MovingAir_7p5mph), 1.0E-8);
 }
+
+TEST_F(ModelFixture, PlanarSurface_VerticesView) {
+  Model model;
+
+  std::vector<Point3d> vertices{{0, 0, 1}, {0, 0, 0}, {1, 0, 0}, {1, 0, 1}};
+  Surface surface(vertices, model);
+
+  const std::vector<Point3d>& view = surface.verticesView();
+  EXPECT_EQ(vertices, view);
+  EXPECT_EQ(surface.vertices(), view);
+
+  // repeated calls hand out the same cached storage
+  EXPECT_EQ(&view, &surface.verticesView());
+
+  // passing the view back in must not read from the cache while it is being reset
+  std::reverse(vertices.begin(), vertices.end());
+  EXPECT_TRUE(surface.setVertices(vertices));
+  EXPECT_TRUE(surface.setVertices(surface.verticesView()));
+  EXPECT_EQ(vertices, surface.vertices());
+}
@@ -40,6 +40,9 @@
 #include "../StandardsInformationConstruction_Impl.hpp"
 #include "../StandardOpaqueMaterial.hpp"
 #include "../StandardOpaqueMaterial_Impl.hpp"
+#include "../ScheduleRuleset.hpp"
+#include "../ScheduleRule.hpp"
+#include "../ScheduleTypeLimits.hpp"
 
 #include "../../utilities/core/Optional.hpp"
 
@@ -134,3 +137,58 @@ TEST_F(ModelFixture, ResourceObject_Clone) {
   EXPECT_EQ("Material with Changed Data", newConstruction.layers()[0].name().get());
   EXPECT_EQ("Material 1", anotherNewConstruction.layers()[0].name().get());
 }
+
+TEST_F(ModelFixture, ResourceObject_PurgeUnusedResourceObjects) {
+  Model model = exampleModel();
+
+  // Unused schedule with rules, whose day schedules are only used through the rules
+  ScheduleRuleset unusedSchedule(model, 0.5);
+  ScheduleTypeLimits unusedLimits(model);
+  unusedSchedule.setScheduleTypeLimits(unusedLimits);
+  ScheduleRule rule1(unusedSchedule);
+  ScheduleRule rule2(unusedSchedule);
+
+  // Unused construction sharing a material with a used one, and one with a material of its own
+  boost::optional<Construction> usedConstruction;
+  for (const Construction& construction : model.getConcreteModelObjects<Construction>()) {
+    if (construction.numLayers() > 0 && construction.nonResourceObjectUseCount(true) > 0) {
+      usedConstruction = construction;
+      break;
+    }
+  }
+  ASSERT_TRUE(usedConstruction);
+  const Handle sharedMaterialHandle = usedConstruction->layers().front().handle();
+  Construction sharedLayers(model);
+  sharedLayers.setLayers(usedConstruction->layers());
+  StandardOpaqueMaterial unusedMaterial(model);
+  Construction ownLayers(model);
+  ownLayers.setLayers(MaterialVector(1u, unusedMaterial));
+
+  // Reference: the straightforward purge, checking each resource's use count in turn
+  auto reference = model.clone(true).cast<Model>();
+  std::set<Handle> expectedRemoved;
+  for (ResourceObject& resource : reference.getModelObjects<ResourceObject>()) {
+    if (resource.initialized() && (resource.nonResourceObjectUseCount(true) == 0)) {
+      for (const IdfObject& removed : resource.remove()) {
+        expectedRemoved.insert(removed.handle());
+      }
+    }
+  }
+
+  std::set<Handle> removed;
+  for (const IdfObject& object : model.purgeUnusedResourceObjects()) {
+    removed.insert(object.handle());
+  }
+  EXPECT_EQ(expectedRemoved, removed);
+  EXPECT_EQ(reference.numObjects(), model.numObjects());
+
+  EXPECT_TRUE(removed.count(unusedSchedule.handle()));
+  EXPECT_TRUE(removed.count(rule1.handle()));
+  EXPECT_TRUE(removed.count(rule2.handle()));
+  EXPECT_TRUE(removed.count(unusedLimits.handle()));
+  EXPECT_TRUE(removed.count(sharedLayers.handle()));
+  EXPECT_TRUE(removed.count(ownLayers.handle()));
+  EXPECT_TRUE(removed.count(unusedMaterial.handle()));
+  EXPECT_FALSE(removed.count(usedConstruction->handle()));
+  EXPECT_FALSE(removed.count(sharedMaterialHandle));
+}
@@ -285,6 +285,97 @@ TEST_F(ModelFixture, ThreeJSForwardTranslator_ExampleModel) {
   EXPECT_EQ(model.getConcreteModelObjects<SubSurface>().size(), model2->getConcreteModelObjects<SubSurface>().size());
 }
 
+TEST_F(ModelFixture, ThreeJSForwardTranslator_ReuseTriangulations) {
+
+  Model model = exampleModel();
+
+  auto geometryVertices = [](const ThreeScene& scene, const Surface& surface) {
+    boost::optional<ThreeGeometry> geometry = scene.getGeometry(toThreeUUID(toString(surface.handle())));
+    EXPECT_TRUE(geometry);
+    return geometry ? geometry->data().vertices() : std::vector<double>();
+  };
+
+  ThreeJSForwardTranslator ft;
+  ThreeScene scene1 = ft.modelToThreeJS(model, true);
+  EXPECT_EQ(0, ft.errors().size());
+
+  // Nothing changed, the cached triangulations give the same scene geometry
+  ThreeScene scene2 = ft.modelToThreeJS(model, true);
+  ASSERT_EQ(scene1.geometries().size(), scene2.geometries().size());
+  for (const auto& surface : model.getConcreteModelObjects<Surface>()) {
+    EXPECT_EQ(geometryVertices(scene1, surface), geometryVertices(scene2, surface));
+  }
+
+  // Move one surface, only it should be re-triangulated
+  std::vector<Surface> surfaces = model.getConcreteModelObjects<Surface>();
+  auto it = std::find_if(surfaces.begin(), surfaces.end(), [](const auto& s) { return s.subSurfaces().empty(); });
+  ASSERT_NE(it, surfaces.end());
+  Surface moved = *it;
+  Point3dVector vertices = moved.vertices();
+  for (auto& vertex : vertices) {
+    vertex = Point3d(vertex.x(), vertex.y(), vertex.z() + 1.0);
+  }
+  ASSERT_TRUE(moved.setVertices(vertices));
+
+  ThreeScene scene3 = ft.modelToThreeJS(model, true);
+  std::vector<double> before = geometryVertices(scene1, moved);
+  std::vector<double> after = geometryVertices(scene3, moved);
+  ASSERT_EQ(before.size(), after.size());
+  ASSERT_FALSE(after.empty());
+  // three.js is y up, OpenStudio z is the second coordinate
+  double zBefore = 0.0;
+  double zAfter = 0.0;
+  for (size_t i = 1; i < after.size(); i += 3) {
+    zBefore += before[i];
+    zAfter += after[i];
+  }
+  EXPECT_NEAR(zBefore + static_cast<double>(after.size() / 3), zAfter, 1.0e-6);
+
+  // And a fresh translator agrees with the one that reused its triangulations
+  ThreeJSForwardTranslator ft2;
+  ThreeScene scene4 = ft2.modelToThreeJS(model, true);
+  for (const auto& surface : model.getConcreteModelObjects<Surface>()) {
+    EXPECT_EQ(geometryVertices(scene4, surface), geometryVertices(scene3, surface));
+  }
+
+  // Not triangulated is cached separately
+  ThreeScene scene5 = ft.modelToThreeJS(model, false);
+  ThreeScene scene6 = ft2.modelToThreeJS(model, false);
+  EXPECT_EQ(scene6.toJSON(false).size(), scene5.toJSON(false).size());
+}
+
+TEST_F(ModelFixture, ThreeJSForwardTranslator_TriangulationErrors) {
+
+  Model model;
+  Space space(model);
+
+  // One corner is lifted off the plane of the others, computeTriangulation refuses it
+  Point3dVector vertices{{0, 10, 0}, {10, 10, 0.5}, {10, 0, 0}, {0, 0, 0}};
+  Surface warped(vertices, model);
+  warped.setSpace(space);
+
+  auto countTriangulationErrors = [](const ThreeJSForwardTranslator& ft) {
+    std::vector<LogMessage> errors = ft.errors();
+    return std::count_if(errors.begin(), errors.end(),
+                         [](const auto& error) { return error.logChannel() == "utilities.geometry.computeTriangulation"; });
+  };
+
+  // Triangulation runs on worker threads, its errors still belong to this translation
+  ThreeJSForwardTranslator ft;
+  ThreeScene scene1 = ft.modelToThreeJS(model, true);
+  EXPECT_FALSE(scene1.getGeometry(toThreeUUID(toString(warped.handle()))));
+  EXPECT_EQ(1, countTriangulationErrors(ft));
+
+  // Reusing the failed triangulation reports it again
+  ThreeScene scene2 = ft.modelToThreeJS(model, true);
+  EXPECT_EQ(1, countTriangulationErrors(ft));
+
+  // Not triangulating doesn't go through computeTriangulation at all
+  ThreeScene scene3 = ft.modelToThreeJS(model, false);
+  EXPECT_TRUE(scene3.getGeometry(toThreeUUID(toString(warped.handle()))));
+  EXPECT_EQ(0, countTriangulationErrors(ft));
+}
+
 TEST_F(ModelFixture, ThreeJSForwardTranslator_ConstructionAirBoundary) {
 
   ThreeJSForwardTranslator ft;
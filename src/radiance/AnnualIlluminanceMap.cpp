@@ -30,23 +30,73 @@
 #include "AnnualIlluminanceMap.hpp"
 #include "HeaderInfo.hpp"
 
-#include <iostream>
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
+#include <string>
 #include <vector>
 
-#include <boost/lexical_cast.hpp>
-#include <boost/regex.hpp>
-
-#include <boost/algorithm/string.hpp>
-#include <boost/tokenizer.hpp>
-
 using namespace std;
-using namespace boost;
 using namespace openstudio;
 
 namespace openstudio {
 namespace radiance {
 
+  namespace {
+
+    // Parses the numbers on the line [begin, end), appending them to values. Returns false if there is something else than a number
+    template <typename T, typename Convert>
+    bool parseNumbers(const char* begin, const char* end, std::vector<T>& values, Convert convert) {
+      const char* p = begin;
+      while (true) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+          ++p;
+        }
+        if (p == end) {
+          return true;
+        }
+        // the buffer is null terminated, and strtod stops at the next space or end of line at the latest
+        char* numberEnd = nullptr;
+        const double value = std::strtod(p, &numberEnd);
+        if (numberEnd == p || numberEnd > end) {
+          return false;
+        }
+        values.push_back(convert(value));
+        p = numberEnd;
+      }
+    }
+
+    /** Reduces the illuminance at each point over the maps at timeIndices, going through the values in memory order. Returns an M x N
+     *  Matrix like AnnualIlluminanceMap::illuminanceMap, all zeros if there are no time indices. */
+    template <typename Accumulate, typename Finish>
+    Matrix reduceOverTime(const std::vector<float>& illuminance, size_t M, size_t N, size_t numTimes,
+                          const std::vector<unsigned>& timeIndices, Accumulate accumulate, Finish finish) {
+      Matrix result(M, N, 0.0);
+      if (timeIndices.empty()) {
+        return result;
+      }
+
+      std::vector<double> acc(M * N, 0.0);
+      for (unsigned t : timeIndices) {
+        if (t >= numTimes) {
+          LOG_FREE_AND_THROW("radiance.AnnualIlluminanceMap", "Time index " << t << " is out of range, there are " << numTimes << " maps");
+        }
+        const float* values = illuminance.data() + t * M * N;
+        for (size_t k = 0; k < acc.size(); ++k) {
+          acc[k] = accumulate(acc[k], values[k]);
+        }
+      }
+
+      for (size_t j = 0; j < N; ++j) {
+        for (size_t i = 0; i < M; ++i) {
+          result(i, j) = finish(acc[j * M + i]);
+        }
+      }
+      return result;
+    }
+
+  }  // namespace
+
   /// default constructor
   AnnualIlluminanceMap::AnnualIlluminanceMap() = default;
 
@@ -62,48 +112,53 @@ namespace radiance {
       return;
     }
 
-    // open file
-    openstudio::filesystem::ifstream file(path);
+    // read the whole file in one go, the values are then parsed in place
+    std::string contents;
+    {
+      openstudio::filesystem::ifstream file(path, std::ios_base::in | std::ios_base::binary);
+      file.seekg(0, std::ios_base::end);
+      const auto size = static_cast<std::streamoff>(file.tellg());
+      if (size > 0) {
+        contents.resize(static_cast<size_t>(size));
+        file.seekg(0, std::ios_base::beg);
+        file.read(contents.data(), size);
+        contents.resize(static_cast<size_t>(file.gcount()));
+      }
+    }
 
     // keep track of line number
     unsigned lineNum = 0;
 
     // keep track of matrix size
-    unsigned M = 0;
-    unsigned N = 0;
-
-    // temp string to read file
-    string line;
+    size_t M = 0;
+    size_t N = 0;
 
     // lines 1 and 2 are the header lines
     string line1;
-    string line2;
-
-    // this will contain matches to regular expressions
-    smatch matches;
-
-    // matches a single number followed by either tabs or spaces
-    const regex singleNumber("([-+]?[0-9]*\\.?[0-9]+)[\\s\\t]*");
 
     // conversion from footcandles to lux
     const double footcandlesToLux(10.76);
 
+    // the 6 standard items at the start of each line
+    std::vector<double> lineHeader;
+    lineHeader.reserve(6);
+
     // read the rest of the file line by line
-    while (getline(file, line)) {
+    const char* const fileEnd = contents.data() + contents.size();
+    for (const char* lineBegin = contents.data(); lineBegin < fileEnd;) {
+      const char* lineEnd = std::find(lineBegin, fileEnd, '\n');
+      const char* nextLine = (lineEnd == fileEnd) ? fileEnd : lineEnd + 1;
       ++lineNum;
 
       if (lineNum == 1) {
 
         // save line 1
-        line1 = line;
+        line1.assign(lineBegin, lineEnd);
 
       } else if (lineNum == 2) {
 
-        // save line 2
-        line2 = line;
-
         // create the header info
-        HeaderInfo headerInfo(line1, line2);
+        HeaderInfo headerInfo(line1, std::string(lineBegin, lineEnd));
 
         // we can now initialize x and y vectors
         m_xVector = headerInfo.xVector();
@@ -112,66 +167,154 @@ namespace radiance {
         M = m_xVector.size();
         N = m_yVector.size();
 
+      } else if (std::all_of(lineBegin, lineEnd, [](char c) { return c == ' ' || c == '\t' || c == '\r'; })) {
+
+        // skip blank lines
+
       } else {
 
         // each line contains the month, day, time (in hours),
         // Solar Azimuth(degrees from south), Solar Altitude(degrees), Global Horizontal Illuminance (fc)
-        // followed by M*N illuminance points
+        // followed by M*N illuminance points, x varying fastest
+        const size_t offset = m_illuminance.size();
+        lineHeader.clear();
+
+        // data lines all have about the same length, estimate their number from the first one
+        if (m_dateTimes.empty()) {
+          const size_t expectedLines = static_cast<size_t>(fileEnd - lineBegin) / static_cast<size_t>(nextLine - lineBegin) + 1;
+          m_dateTimes.reserve(expectedLines);
+          m_illuminance.reserve(expectedLines * M * N);
+        }
 
-        // break the line up by spaces
-        vector<string> lineVector;
-        tokenizer<char_separator<char>, std::string::const_iterator, std::string> tk(line, char_separator<char>(" "));
-        for (tokenizer<char_separator<char>, std::string::const_iterator, std::string>::iterator it(tk.begin()); it != tk.end(); ++it) {
-          lineVector.push_back(*it);
+        // the header items are read into lineHeader, then the values are appended directly to the illuminance
+        const char* p = lineBegin;
+        for (unsigned k = 0; k < 6 && p < lineEnd; ++k) {
+          while (p < lineEnd && (*p == ' ' || *p == '\t' || *p == '\r')) {
+            ++p;
+          }
+          const char* tokenEnd = std::find_if(p, lineEnd, [](char c) { return c == ' ' || c == '\t' || c == '\r'; });
+          if (!parseNumbers(p, tokenEnd, lineHeader, [](double v) { return v; })) {
+            break;
+          }
+          p = tokenEnd;
         }
 
-        // total number minus 6 standard header items
-        unsigned numValues = lineVector.size() - 6;
+        auto toLux = [&footcandlesToLux](double v) { return static_cast<float>(footcandlesToLux * v); };
+        const bool parsed = (lineHeader.size() == 6) && parseNumbers(p, lineEnd, m_illuminance, toLux);
+        if (!parsed) {
+          m_illuminance.resize(offset);
+          LOG(Fatal, "Cannot read illuminance values on line " << lineNum << ".");
+          break;
+        }
 
+        // total number minus 6 standard header items
+        const size_t numValues = m_illuminance.size() - offset;
         if (numValues != M * N) {
+          m_illuminance.resize(offset);
           LOG(Fatal, "Incorrect number of illuminance values read " << numValues << ", expecting " << M * N << ".");
-          return;
-        } else {
+          break;
+        }
 
-          MonthOfYear thisMonth = monthOfYear(lexical_cast<unsigned>(lineVector[0]));
-          auto day = lexical_cast<unsigned>(lineVector[1]);
-          double fracDays = lexical_cast<double>(lineVector[2]) / 24.0;
+        MonthOfYear thisMonth = monthOfYear(static_cast<unsigned>(lineHeader[0]));
+        auto day = static_cast<unsigned>(lineHeader[1]);
+        double fracDays = lineHeader[2] / 24.0;
 
-          // ignore solar angles and global horizontal for now
+        // ignore solar angles and global horizontal for now
 
-          // make the date time
-          DateTime dateTime(Date(thisMonth, day), Time(fracDays));
+        // make the date time
+        m_dateTimes.emplace_back(Date(thisMonth, day), Time(fracDays));
+      }
 
-          // matrix we are going to read in
-          Matrix illuminanceMap(M, N);
+      lineBegin = nextLine;
+    }
 
-          // read in the values
-          unsigned index = 6;
-          for (unsigned j = 0; j < N; ++j) {
-            for (unsigned i = 0; i < M; ++i) {
-              illuminanceMap(i, j) = footcandlesToLux * lexical_cast<double>(lineVector[index]);
-              ++index;
-            }
-          }
+    // rows read before a malformed one are kept
+    m_sortedTimeIndices = allTimeIndices();
+    std::stable_sort(m_sortedTimeIndices.begin(), m_sortedTimeIndices.end(),
+                     [this](unsigned lhs, unsigned rhs) { return m_dateTimes[lhs] < m_dateTimes[rhs]; });
+  }
 
-          m_dateTimes.push_back(dateTime);
-          m_dateTimeIlluminanceMap[dateTime] = illuminanceMap;
-        }
-      }
+  std::vector<unsigned> AnnualIlluminanceMap::allTimeIndices() const {
+    std::vector<unsigned> result(m_dateTimes.size());
+    for (unsigned t = 0; t < result.size(); ++t) {
+      result[t] = t;
     }
-
-    // close file
-    file.close();
+    return result;
   }
 
   /// get the illuminance map in lux corresponding to date and time
   openstudio::Matrix AnnualIlluminanceMap::illuminanceMap(const openstudio::DateTime& dateTime) const {
-    auto it = m_dateTimeIlluminanceMap.find(dateTime);
-    if (it != m_dateTimeIlluminanceMap.end()) {
-      return it->second;
+    boost::optional<unsigned> t = timeIndex(dateTime);
+    if (!t) {
+      return m_nullIlluminanceMap;
+    }
+
+    const size_t M = m_xVector.size();
+    const size_t N = m_yVector.size();
+    Matrix result(M, N);
+    const float* values = m_illuminance.data() + *t * mapSize();
+    for (size_t j = 0; j < N; ++j) {
+      for (size_t i = 0; i < M; ++i) {
+        result(i, j) = *values++;
+      }
+    }
+    return result;
+  }
+
+  boost::optional<unsigned> AnnualIlluminanceMap::timeIndex(const openstudio::DateTime& dateTime) const {
+    // the last of the equal date and times, to match the previous behavior where later maps replaced earlier ones
+    auto it = std::upper_bound(m_sortedTimeIndices.begin(), m_sortedTimeIndices.end(), dateTime,
+                               [this](const DateTime& lhs, unsigned rhs) { return lhs < m_dateTimes[rhs]; });
+    if (it == m_sortedTimeIndices.begin() || m_dateTimes[*std::prev(it)] != dateTime) {
+      return boost::none;
     }
+    return *std::prev(it);
+  }
+
+  std::vector<unsigned> AnnualIlluminanceMap::timeIndices(const openstudio::DateTime& start, const openstudio::DateTime& end) const {
+    auto first = std::lower_bound(m_sortedTimeIndices.begin(), m_sortedTimeIndices.end(), start,
+                                  [this](unsigned lhs, const DateTime& rhs) { return m_dateTimes[lhs] < rhs; });
+    auto last = std::upper_bound(first, m_sortedTimeIndices.end(), end,
+                                 [this](const DateTime& lhs, unsigned rhs) { return lhs < m_dateTimes[rhs]; });
+    return {first, last};
+  }
+
+  double AnnualIlluminanceMap::illuminance(unsigned timeIndex, unsigned xIndex, unsigned yIndex) const {
+    if (timeIndex >= m_dateTimes.size() || xIndex >= m_xVector.size() || yIndex >= m_yVector.size()) {
+      LOG_AND_THROW("Index (" << timeIndex << ", " << xIndex << ", " << yIndex << ") is out of range");
+    }
+    return m_illuminance[timeIndex * mapSize() + yIndex * m_xVector.size() + xIndex];
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::meanIlluminanceMap() const {
+    return meanIlluminanceMap(allTimeIndices());
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::meanIlluminanceMap(const std::vector<unsigned>& timeIndices) const {
+    return reduceOverTime(
+      m_illuminance, m_xVector.size(), m_yVector.size(), m_dateTimes.size(), timeIndices,
+      [](double acc, float value) { return acc + value; }, [&timeIndices](double acc) { return acc / timeIndices.size(); });
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::maxIlluminanceMap() const {
+    return maxIlluminanceMap(allTimeIndices());
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::maxIlluminanceMap(const std::vector<unsigned>& timeIndices) const {
+    return reduceOverTime(
+      m_illuminance, m_xVector.size(), m_yVector.size(), m_dateTimes.size(), timeIndices,
+      [](double acc, float value) { return std::max(acc, static_cast<double>(value)); }, [](double acc) { return acc; });
+  }
+
+  openstudio::Matrix AnnualIlluminanceMap::daylightAutonomy(double minIlluminance) const {
+    return daylightAutonomy(minIlluminance, allTimeIndices());
+  }
 
-    return m_nullIlluminanceMap;
+  openstudio::Matrix AnnualIlluminanceMap::daylightAutonomy(double minIlluminance, const std::vector<unsigned>& timeIndices) const {
+    return reduceOverTime(
+      m_illuminance, m_xVector.size(), m_yVector.size(), m_dateTimes.size(), timeIndices,
+      [minIlluminance](double acc, float value) { return (value >= minIlluminance) ? acc + 1.0 : acc; },
+      [&timeIndices](double acc) { return acc / timeIndices.size(); });
   }
 
 }  // namespace radiance
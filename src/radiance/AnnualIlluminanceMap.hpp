@@ -38,19 +38,22 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Path.hpp"
 
+#include <boost/optional.hpp>
+
+#include <vector>
+
 namespace openstudio {
 namespace radiance {
 
   /** AnnualIlluminanceMap represents illuminance map for an entire year.
   *   We assume that the output files is from SPOT, with length in meters and illuminance
   *   values in footcandles.  All illuminance values are converted to lux.
+  *
+  *   The illuminance values are stored in a single contiguous array, laid out [time][y][x]
+  *   with time in the order of dateTimes(), so that whole year queries only walk memory once.
   */
   class RADIANCE_API AnnualIlluminanceMap
   {
-   private:
-    // map of DateTime to Matrix (illuminance map)
-    using DateTimeIlluminanceMap = std::map<openstudio::DateTime, openstudio::Matrix>;
-
    public:
     /// default constructor
     AnnualIlluminanceMap();
@@ -80,16 +83,58 @@ namespace radiance {
     /// get the illuminance map in lux corresponding to date and time
     openstudio::Matrix illuminanceMap(const openstudio::DateTime& dateTime) const;
 
+    /// get the index in dateTimes() of date and time, if there are duplicates the last one is returned
+    boost::optional<unsigned> timeIndex(const openstudio::DateTime& dateTime) const;
+
+    /// get the indices in dateTimes() of all date and times between start and end (inclusive), in chronological order
+    std::vector<unsigned> timeIndices(const openstudio::DateTime& start, const openstudio::DateTime& end) const;
+
+    /// get the illuminance in lux at x point xIndex and y point yIndex for the date and time at timeIndex in dateTimes()
+    double illuminance(unsigned timeIndex, unsigned xIndex, unsigned yIndex) const;
+
+    /// get all illuminance values in lux, laid out [time][y][x] with time in the order of dateTimes()
+    const std::vector<float>& illuminanceValues() const {
+      return m_illuminance;
+    }
+
+    /// get the mean illuminance in lux at each point over all date and times
+    openstudio::Matrix meanIlluminanceMap() const;
+
+    /// get the mean illuminance in lux at each point over the date and times at timeIndices
+    openstudio::Matrix meanIlluminanceMap(const std::vector<unsigned>& timeIndices) const;
+
+    /// get the maximum illuminance in lux at each point over all date and times
+    openstudio::Matrix maxIlluminanceMap() const;
+
+    /// get the maximum illuminance in lux at each point over the date and times at timeIndices
+    openstudio::Matrix maxIlluminanceMap(const std::vector<unsigned>& timeIndices) const;
+
+    /// get the daylight autonomy at each point: the fraction of all date and times with at least minIlluminance lux
+    openstudio::Matrix daylightAutonomy(double minIlluminance) const;
+
+    /// get the daylight autonomy at each point: the fraction of the date and times at timeIndices with at least minIlluminance lux
+    openstudio::Matrix daylightAutonomy(double minIlluminance, const std::vector<unsigned>& timeIndices) const;
+
    private:
     REGISTER_LOGGER("radiance.AnnualIlluminanceMap");
 
     void init(const openstudio::path& path);
 
+    // number of values in each illuminance map
+    size_t mapSize() const {
+      return m_xVector.size() * m_yVector.size();
+    }
+
+    std::vector<unsigned> allTimeIndices() const;
+
     openstudio::DateTimeVector m_dateTimes;
     openstudio::Vector m_xVector;
     openstudio::Vector m_yVector;
     openstudio::Matrix m_nullIlluminanceMap;  // used when there is no data
-    DateTimeIlluminanceMap m_dateTimeIlluminanceMap;
+    // illuminance in lux, [time][y][x] with time in the order of m_dateTimes
+    std::vector<float> m_illuminance;
+    // indices into m_dateTimes sorted by date and time, duplicates are kept in file order
+    std::vector<unsigned> m_sortedTimeIndices;
   };
 
 }  // namespace radiance
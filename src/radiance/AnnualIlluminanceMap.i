@@ -21,6 +21,7 @@
 %template(AnnualIlluminanceMapVector) std::vector< std::shared_ptr<openstudio::radiance::AnnualIlluminanceMap> >;
 
 %ignore openstudio::radiance::AnnualIlluminanceMap::AnnualIlluminanceMap(const openstudio::Path&);
+%ignore openstudio::radiance::AnnualIlluminanceMap::illuminanceValues;
 
 %include <radiance/AnnualIlluminanceMap.hpp>
 
@@ -75,6 +75,7 @@
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/PathHelpers.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
+#include "../utilities/core/ParallelFor.hpp"
 #include "../utilities/time/DateTime.hpp"
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/Transformation.hpp"
@@ -156,6 +157,73 @@ namespace radiance {
     return boost::lexical_cast<std::string>(t);
   }
 
+  namespace {
+
+    // Everything getPolygons needs from the model, so that the subtraction can run off the calling thread
+    struct SurfacePolygonsInput
+    {
+      Transformation toWorld;
+      Transformation alignFace;
+      Point3dVector faceVertices;
+      std::vector<Point3dVector> holes;
+    };
+
+    SurfacePolygonsInput surfacePolygonsInput(const Surface& surface) {
+      SurfacePolygonsInput result;
+
+      Transformation buildingTransformation;
+      OptionalBuilding building = surface.model().getOptionalUniqueModelObject<Building>();
+      if (building) {
+        buildingTransformation = building->transformation();
+      }
+
+      Transformation spaceTransformation;
+      OptionalSpace space = surface.space();
+      if (space) {
+        spaceTransformation = space->transformation();
+      }
+      result.toWorld = buildingTransformation * spaceTransformation;
+
+      // transformation from space coordinates to face coordinates
+      result.alignFace = Transformation::alignFace(surface.verticesView());
+      const Transformation alignFaceInverse = result.alignFace.inverse();
+
+      // get the current vertices and convert to face coordinates
+      result.faceVertices = alignFaceInverse * surface.verticesView();
+
+      // boost polygon wants vertices in clockwise order, faceVertices must be reversed, otherFaceVertices already CCW
+      std::reverse(result.faceVertices.begin(), result.faceVertices.end());
+
+      // get the current subsurfaces and convert to face coordinates
+      for (const SubSurface& subSurface : surface.subSurfaces()) {
+        Point3dVector hole = alignFaceInverse * subSurface.verticesView();
+        std::reverse(hole.begin(), hole.end());
+        result.holes.push_back(std::move(hole));
+      }
+
+      return result;
+    }
+
+    // Does not touch the model, safe to call from any thread
+    openstudio::Point3dVectorVector surfacePolygons(const SurfacePolygonsInput& input) {
+      openstudio::Point3dVectorVector result;
+
+      // perform the subtraction
+      std::vector<std::vector<Point3d>> faceResult = openstudio::subtract(input.faceVertices, input.holes, 0.01);
+
+      // convert to absolute coordinates
+      const Transformation faceToWorld = input.toWorld * input.alignFace;
+      for (const Point3dVector& face : faceResult) {
+        Point3dVector worldFace = faceToWorld * face;
+        std::reverse(worldFace.begin(), worldFace.end());
+        result.push_back(std::move(worldFace));
+      }
+
+      return result;
+    }
+
+  }  // namespace
+
   // basic constructor
   ForwardTranslator::ForwardTranslator()
     : m_windowGroupId(1)  // m_windowGroupId is reserved for uncontrolled
@@ -473,52 +541,13 @@ namespace radiance {
   }
 
   openstudio::Point3dVectorVector ForwardTranslator::getPolygons(const openstudio::model::Surface& surface) {
-    openstudio::Point3dVectorVector result;
-
-    Transformation buildingTransformation;
-    OptionalBuilding building = surface.model().getOptionalUniqueModelObject<Building>();
-    if (building) {
-      buildingTransformation = building->transformation();
-    }
-
-    Transformation spaceTransformation;
-    OptionalSpace space = surface.space();
-    if (space) {
-      spaceTransformation = space->transformation();
-    }
-
-    // transformation from space coordinates to face coordinates
-    Transformation alignFace = Transformation::alignFace(surface.vertices());
-
-    // get the current vertices and convert to face coordinates
-    Point3dVector surfaceFaceVertices = alignFace.inverse() * surface.vertices();
-
-    // boost polygon wants vertices in clockwise order, faceVertices must be reversed, otherFaceVertices already CCW
-    std::reverse(surfaceFaceVertices.begin(), surfaceFaceVertices.end());
+    openstudio::Point3dVectorVector result = surfacePolygons(surfacePolygonsInput(surface));
 
-    // get the current subsurfaces and convert to face coordinates
-    std::vector<std::vector<Point3d>> holes;
-    for (const SubSurface& subSurface : surface.subSurfaces()) {
-      Point3dVector hole = alignFace.inverse() * subSurface.vertices();
-      std::reverse(hole.begin(), hole.end());
-      holes.push_back(hole);
-    }
-
-    // perform the subtraction
-    std::vector<std::vector<Point3d>> faceResult = openstudio::subtract(surfaceFaceVertices, holes, 0.01);
-
-    if (faceResult.empty()) {
+    if (result.empty()) {
       // DLM: is this an error (fail simulation) or a warning?  Should we attempt to put the whole surface in here?
       LOG(Warn, "Failed to create surface polygons for Surface '" << surface.nameString() << "'");
     }
 
-    // convert to absolute coordinates
-    for (const Point3dVector& face : faceResult) {
-      Point3dVector worldFace = buildingTransformation * spaceTransformation * alignFace * face;
-      std::reverse(worldFace.begin(), worldFace.end());
-      result.push_back(worldFace);
-    }
-
     return result;
   }
 
@@ -591,7 +620,7 @@ namespace radiance {
     }
 
     // convert vertices to absolute coordinates
-    return transformation * shadingSurface.vertices();
+    return transformation * shadingSurface.verticesView();
   }
 
   openstudio::Point3dVector ForwardTranslator::getPolygon(const openstudio::model::InteriorPartitionSurface& interiorPartitionSurface) {
@@ -614,7 +643,7 @@ namespace radiance {
     }
 
     // convert vertices to absolute coordinates
-    return buildingTransformation * spaceTransformation * interiorPartitionSurfaceGroupTransformation * interiorPartitionSurface.vertices();
+    return buildingTransformation * spaceTransformation * interiorPartitionSurfaceGroupTransformation * interiorPartitionSurface.verticesView();
   }
 
   openstudio::Point3dVector ForwardTranslator::getPolygon(const openstudio::model::Luminaire& luminaire) {
@@ -1020,6 +1049,34 @@ namespace radiance {
                                          std::vector<openstudio::path>& t_outfiles) {
     std::vector<std::string> space_names;
 
+    // Subtracting the sub surfaces from the surfaces is the bulk of the geometry work. The model is not thread safe, so gather the vertices
+    // here then run the subtractions in parallel, the loop below only looks the results up
+    std::vector<UUID> polygonHandles;
+    std::vector<SurfacePolygonsInput> polygonInputs;
+    for (const auto& space : t_spaces) {
+      for (const auto& surface : space.surfaces()) {
+        if (!surface.isAirWall()) {
+          polygonHandles.push_back(surface.handle());
+          polygonInputs.push_back(surfacePolygonsInput(surface));
+        }
+      }
+    }
+    std::vector<openstudio::Point3dVectorVector> allPolygons(polygonInputs.size());
+    parallelFor(polygonInputs.size(), [&](size_t i) { allPolygons[i] = surfacePolygons(polygonInputs[i]); });
+    std::map<UUID, openstudio::Point3dVectorVector> surfacePolygonsMap;
+    for (size_t i = 0; i < polygonHandles.size(); ++i) {
+      surfacePolygonsMap.emplace(polygonHandles[i], std::move(allPolygons[i]));
+    }
+
+    // Files made while going through the spaces are collected and written after the loop, they are independent so this is done in parallel
+    struct PendingFile
+    {
+      openstudio::path path;
+      std::string content;
+      bool sceneFile;
+    };
+    std::vector<PendingFile> pendingFiles;
+
     for (const auto& space : t_spaces) {
       std::string space_name = cleanName(space.name().get());
 
@@ -1062,7 +1119,10 @@ namespace radiance {
         }
 
         // create polygon object
-        openstudio::Point3dVectorVector polygons = openstudio::radiance::ForwardTranslator::getPolygons(surface);
+        openstudio::Point3dVectorVector polygons = std::move(surfacePolygonsMap[surface.handle()]);
+        if (polygons.empty()) {
+          LOG(Warn, "Failed to create surface polygons for Surface '" << surface.nameString() << "'");
+        }
         for (const openstudio::Point3dVector& polygon : polygons) {
 
           if (!surface.adjacentSurface()) {
@@ -1470,24 +1530,12 @@ namespace radiance {
                   switchableGroup_wgMats = "void " + rMaterial + " " + windowGroup_name + "\n" + matString + "\n";
 
                   openstudio::path filename = t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + "_clear.mat");
-                  OFSTREAM file(filename);
-                  if (file.is_open()) {
-                    t_outfiles.push_back(filename);
-                    file << switchableGroup_wgMats;
-                  } else {
-                    LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-                  }
+                  pendingFiles.push_back({filename, switchableGroup_wgMats, false});
 
                   switchableGroup_wgMats = "void " + rMaterial + " " + windowGroup_name + "_TINTED\n" + matStringTinted + "\n\nvoid alias "
                                            + windowGroup_name + " " + windowGroup_name + "_TINTED " + "\n\n";
                   openstudio::path filename2 = t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + "_tinted.mat");
-                  OFSTREAM file2(filename2);
-                  if (file2.is_open()) {
-                    t_outfiles.push_back(filename2);
-                    file2 << switchableGroup_wgMats;
-                  } else {
-                    LOG(Error, "Cannot open file '" << toString(filename2) << "' for writing");
-                  }
+                  pendingFiles.push_back({filename2, switchableGroup_wgMats, false});
 
                 } else {
 
@@ -1495,13 +1543,7 @@ namespace radiance {
                   std::string wgMat = "";
                   wgMat = "void " + rMaterial + " " + windowGroup_name + "\n" + matString + "\n\n";
                   openstudio::path wgSingleFilename = t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + ".mat");
-                  OFSTREAM wgSingleFile(wgSingleFilename);
-                  if (wgSingleFile.is_open()) {
-                    t_outfiles.push_back(wgSingleFilename);
-                    wgSingleFile << wgMat;
-                  } else {
-                    LOG(Error, "Cannot open file '" << toString(wgSingleFilename) << "' for writing");
-                  }
+                  pendingFiles.push_back({wgSingleFilename, wgMat, false});
                 }
               }
               // write the polygon
@@ -1567,13 +1609,7 @@ namespace radiance {
                   wgShadeMat = "void " + rMaterial + " " + windowGroup_name + "_SHADE\n" + matString + "\n\n";
                   openstudio::path wgSingleFilename =
                     t_radDir / openstudio::toPath("materials") / openstudio::toPath(windowGroup_name + "_SHADE.mat");
-                  OFSTREAM wgSingleFile(wgSingleFilename);
-                  if (wgSingleFile.is_open()) {
-                    t_outfiles.push_back(wgSingleFilename);
-                    wgSingleFile << wgShadeMat;
-                  } else {
-                    LOG(Error, "Cannot open file '" << toString(wgSingleFilename) << "' for writing");
-                  }
+                  pendingFiles.push_back({wgSingleFilename, wgShadeMat, false});
 
                   // shade BSDF stuff
 
@@ -1830,13 +1866,7 @@ namespace radiance {
 
         // write daylighting controls
         openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(space_name + ".sns");
-        OFSTREAM file(filename);
-        if (file.is_open()) {
-          t_outfiles.push_back(filename);
-          file << m_radSensors[space_name];
-        } else {
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        pendingFiles.push_back({filename, m_radSensors[space_name], false});
 
         // write daylighting control view file
         m_radSensorViews[space_name] = "";
@@ -1846,13 +1876,7 @@ namespace radiance {
                                         + " -vu 0 1 0 -vh 180 -vv 180 -vo 0 -vs 0 -vl 0\n";
 
         filename = t_radDir / openstudio::toPath("views") / openstudio::toPath(space_name + "_dc.vfh");
-        OFSTREAM file2(filename);
-        if (file2.is_open()) {
-          t_outfiles.push_back(filename);
-          file2 << m_radSensorViews[space_name];
-        } else {
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        pendingFiles.push_back({filename, m_radSensorViews[space_name], false});
 
         LOG(Debug, "Wrote " << space_name << "_dc.vfh");
 
@@ -1898,37 +1922,19 @@ namespace radiance {
 
         // write glare sensors
         openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(space_name + "_" + sensor_name + ".glr");
-        OFSTREAM file(filename);
-        if (file.is_open()) {
-          t_outfiles.push_back(filename);
-          file << m_radGlareSensors[space_name];
-        } else {
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        pendingFiles.push_back({filename, m_radGlareSensors[space_name], false});
 
         LOG(Debug, "Wrote " << space_name << ".glr");
 
         // write glare sensor views (perspective)
         filename = t_radDir / openstudio::toPath("views") / openstudio::toPath(space_name + "_" + sensor_name + "_gs.vfv");
-        OFSTREAM file2(filename);
-        if (file2.is_open()) {
-          t_outfiles.push_back(filename);
-          file2 << m_radGlareSensorViewsVTV[space_name];
-        } else {
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        pendingFiles.push_back({filename, m_radGlareSensorViewsVTV[space_name], false});
 
         LOG(Debug, "Wrote " << space_name << "_" << sensor_name << "_gs.vfv");
 
         // write glare sensor views (fisheye)
         filename = t_radDir / openstudio::toPath("views") / openstudio::toPath(space_name + "_" + sensor_name + "_gs.vfh");
-        OFSTREAM file3(filename);
-        if (file3.is_open()) {
-          t_outfiles.push_back(filename);
-          file3 << m_radGlareSensorViewsVTA[space_name];
-        } else {
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
-        }
+        pendingFiles.push_back({filename, m_radGlareSensorViewsVTA[space_name], false});
 
         LOG(Debug, "Wrote " << space_name << "_" << sensor_name << "_gs.vfh");
 
@@ -1942,34 +1948,58 @@ namespace radiance {
 
         // write map file
         openstudio::path filename = t_radDir / openstudio::toPath("numeric") / openstudio::toPath(space_name + ".map");
-        OFSTREAM file(filename);
-        if (file.is_open()) {
-          t_outfiles.push_back(filename);
-
-          std::vector<Point3d> referencePoints = openstudio::radiance::ForwardTranslator::getReferencePoints(map);
-          for (const auto& point : referencePoints) {
-            m_radMaps[space_name] +=
-              "" + formatString(point.x(), 3) + " " + formatString(point.y(), 3) + " " + formatString(point.z(), 3) + " 0.000 0.000 1.000\n";
-          }
-          file << m_radMaps[space_name];
-        } else {
-          LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
+        std::vector<Point3d> referencePoints = openstudio::radiance::ForwardTranslator::getReferencePoints(map);
+        for (const auto& point : referencePoints) {
+          m_radMaps[space_name] +=
+            "" + formatString(point.x(), 3) + " " + formatString(point.y(), 3) + " " + formatString(point.z(), 3) + " 0.000 0.000 1.000\n";
         }
+        pendingFiles.push_back({filename, m_radMaps[space_name], false});
 
         LOG(Debug, "wrote " << space_name << ".map");
       }  //end illuminance map
 
       // write geometry
       openstudio::path filename = t_radDir / openstudio::toPath("scene") / openstudio::toPath(space_name + ".rad");
-      OFSTREAM file(filename);
+      pendingFiles.push_back({filename, m_radSpaces[space_name], true});
+    }
+
+    // The same file can be made more than once (window group materials, spaces with the same cleaned name), only write its last content
+    std::map<openstudio::path, size_t> lastPendingFile;
+    for (size_t i = 0; i < pendingFiles.size(); ++i) {
+      lastPendingFile[pendingFiles[i].path] = i;
+    }
+    // Flag the last pending file of each path up front, the writers only read it
+    std::vector<char> isLastPendingFile(pendingFiles.size(), 0);
+    for (const auto& [path, i] : lastPendingFile) {
+      isLastPendingFile[i] = 1;
+    }
+    std::vector<char> pendingFileWritten(pendingFiles.size(), 0);
+    parallelFor(pendingFiles.size(), [&](size_t i) {
+      if (isLastPendingFile[i] == 0) {
+        return;
+      }
+      OFSTREAM file(pendingFiles[i].path);
       if (file.is_open()) {
-        t_outfiles.push_back(filename);
-        m_radSceneFiles.push_back(filename);
-        file << m_radSpaces[space_name];
+        file << pendingFiles[i].content;
+        pendingFileWritten[i] = 1;
+      }
+    });
+    for (size_t i = 0; i < pendingFiles.size(); ++i) {
+      if (isLastPendingFile[i] == 0) {
+        continue;
+      }
+      if (pendingFileWritten[i] != 0) {
+        t_outfiles.push_back(pendingFiles[i].path);
+        if (pendingFiles[i].sceneFile) {
+          m_radSceneFiles.push_back(pendingFiles[i].path);
+        }
       } else {
-        LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
+        LOG(Error, "Cannot open file '" << toString(pendingFiles[i].path) << "' for writing");
       }
+    }
 
+    // The window groups and materials are shared by all spaces, write them once they are complete
+    if (!t_spaces.empty()) {
       for (const auto& windowGroup : m_windowGroups) {
         std::string windowGroup_name = windowGroup.name();
 
@@ -31,6 +31,8 @@
 
 #include "../AnnualIlluminanceMap.hpp"
 
+#include "../../utilities/core/Filesystem.hpp"
+
 #include <resources.hxx>
 
 using namespace std;
@@ -73,3 +75,92 @@ AnnualIlluminanceMap RadAnnualIlluminanceMapFixture::outFile;
 ///////////////////////////////////////////////////////////////////////////////
 
 TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap) {}
+
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_Tensor) {
+  // 3 x points (0, 1, 2) and 2 y points (0, 1), values in footcandles with x varying fastest
+  openstudio::path path = openstudio::filesystem::temp_directory_path() / toPath("AnnualIlluminanceMap_Tensor.ill");
+  {
+    openstudio::filesystem::ofstream file(path);
+    file << "0 0 0 2 0 0 0 1 0\n";
+    file << "1 1 0\n";
+    file << "1 1 13 0 45 1000 1 2 3 4 5 6\n";
+    file << "1 1 11 0 45 1000 10 20 30 40 50 60\r\n";
+    file << "1 1 12 0 45 1000 0 0 0 0 100 0\n";
+  }
+
+  AnnualIlluminanceMap map(path);
+  ASSERT_EQ(3u, map.xVector().size());
+  ASSERT_EQ(2u, map.yVector().size());
+  ASSERT_EQ(3u, map.dateTimes().size());
+  ASSERT_EQ(3u * 6u, map.illuminanceValues().size());
+
+  const openstudio::DateTime at11(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(11 / 24.0));
+  const openstudio::DateTime at12(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(12 / 24.0));
+  const openstudio::DateTime at13(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(13 / 24.0));
+
+  // time indices are in file order, timeIndices is in chronological order
+  ASSERT_TRUE(map.timeIndex(at11));
+  EXPECT_EQ(1u, map.timeIndex(at11).get());
+  EXPECT_EQ(0u, map.timeIndex(at13).get());
+  EXPECT_FALSE(map.timeIndex(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 2), openstudio::Time(11 / 24.0))));
+  EXPECT_EQ(std::vector<unsigned>({1, 2, 0}), map.timeIndices(at11, at13));
+  EXPECT_EQ(std::vector<unsigned>({2}), map.timeIndices(at12, at12));
+
+  openstudio::Matrix illuminanceMap = map.illuminanceMap(at11);
+  ASSERT_EQ(3u, illuminanceMap.size1());
+  ASSERT_EQ(2u, illuminanceMap.size2());
+  EXPECT_NEAR(10.76 * 20, illuminanceMap(1, 0), 0.001);
+  EXPECT_NEAR(10.76 * 40, illuminanceMap(0, 1), 0.001);
+  EXPECT_NEAR(10.76 * 40, map.illuminance(1, 0, 1), 0.001);
+  EXPECT_THROW(map.illuminance(3, 0, 0), std::exception);
+
+  openstudio::Matrix mean = map.meanIlluminanceMap();
+  EXPECT_NEAR(10.76 * 11 / 3, mean(0, 0), 0.001);
+  EXPECT_NEAR(10.76 * 155 / 3, mean(1, 1), 0.001);
+
+  openstudio::Matrix max = map.maxIlluminanceMap(map.timeIndices(at12, at13));
+  EXPECT_NEAR(10.76 * 1, max(0, 0), 0.001);
+  EXPECT_NEAR(10.76 * 100, max(1, 1), 0.001);
+
+  openstudio::Matrix autonomy = map.daylightAutonomy(100.0);
+  EXPECT_NEAR(1.0 / 3.0, autonomy(0, 0), 0.0001);
+  EXPECT_NEAR(2.0 / 3.0, autonomy(1, 1), 0.0001);
+  EXPECT_NEAR(1.0 / 3.0, autonomy(2, 1), 0.0001);
+  EXPECT_THROW(map.daylightAutonomy(100.0, {3}), std::exception);
+
+  openstudio::filesystem::remove(path);
+}
+
+TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap_MalformedRow) {
+  // reading stops at the first bad row, the rows before it remain available
+  const openstudio::DateTime at11(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(11 / 24.0));
+  const openstudio::DateTime at12(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(12 / 24.0));
+
+  for (const std::string badRow : {"1 1 13 0 45 1000 1 2 3\n", "1 1 13 0 45 1000 1 2 x 4 5 6\n"}) {
+    openstudio::path path = openstudio::filesystem::temp_directory_path() / toPath("AnnualIlluminanceMap_MalformedRow.ill");
+    {
+      openstudio::filesystem::ofstream file(path);
+      file << "0 0 0 2 0 0 0 1 0\n";
+      file << "1 1 0\n";
+      file << "1 1 12 0 45 1000 0 0 0 0 100 0\n";
+      file << "1 1 11 0 45 1000 10 20 30 40 50 60\n";
+      file << badRow;
+      file << "1 1 14 0 45 1000 1 2 3 4 5 6\n";
+    }
+
+    AnnualIlluminanceMap map(path);
+    ASSERT_EQ(2u, map.dateTimes().size());
+    ASSERT_EQ(2u * 6u, map.illuminanceValues().size());
+
+    ASSERT_TRUE(map.timeIndex(at11));
+    EXPECT_EQ(1u, map.timeIndex(at11).get());
+    EXPECT_EQ(std::vector<unsigned>({1, 0}), map.timeIndices(at11, at12));
+
+    openstudio::Matrix illuminanceMap = map.illuminanceMap(at12);
+    ASSERT_EQ(3u, illuminanceMap.size1());
+    ASSERT_EQ(2u, illuminanceMap.size2());
+    EXPECT_NEAR(10.76 * 100, illuminanceMap(1, 1), 0.001);
+
+    openstudio::filesystem::remove(path);
+  }
+}
@@ -35,6 +35,7 @@
 #include "../../model/Building.hpp"
 #include "../../model/Building_Impl.hpp"
 #include "../../model/Space.hpp"
+#include "../../model/Space_Impl.hpp"
 #include "../../model/Surface.hpp"
 #include "../../model/SubSurface.hpp"
 #include "../../model/SubSurface_Impl.hpp"
@@ -56,6 +57,12 @@
 #include <utilities/idd/BuildingSurface_Detailed_FieldEnums.hxx>
 #include <utilities/idd/FenestrationSurface_Detailed_FieldEnums.hxx>
 
+#include <boost/algorithm/string.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+
 using namespace openstudio;
 using namespace openstudio::model;
 using namespace openstudio::radiance;
@@ -255,6 +262,78 @@ TEST(Radiance, ForwardTranslator_ExampleModelWithShadingControl) {
   EXPECT_TRUE(ft.warnings().empty()) << printLogMessages(ft.warnings());
 }
 
+TEST(Radiance, ForwardTranslator_ExampleModel_OutputFiles) {
+  Model model = exampleModel();
+
+  // Put the windows in a window group, its material files are made once per window
+  Construction shadedConstruction(model);
+  model::ShadingControl shadingControl(shadedConstruction);
+  unsigned nWindows = 0;
+  for (auto& subSurface : model.getConcreteModelObjects<model::SubSurface>()) {
+    if (istringEqual(subSurface.subSurfaceType(), "FixedWindow") || istringEqual(subSurface.subSurfaceType(), "OperableWindow")) {
+      subSurface.setShadingControl(shadingControl);
+      ++nWindows;
+    }
+  }
+  ASSERT_LT(1u, nWindows);
+
+  // Two spaces whose names clean to the same file name
+  std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+  ASSERT_LE(2u, spaces.size());
+  spaces[0].setName("Duplicated Space");
+  spaces[1].setName("Duplicated:Space");
+
+  openstudio::path outpath = toPath("./ForwardTranslator_ExampleModel_OutputFiles");
+  openstudio::filesystem::remove_all(outpath);
+  ASSERT_FALSE(openstudio::filesystem::exists(outpath));
+
+  ForwardTranslator ft;
+  std::vector<path> outpaths = ft.translateModel(outpath, model);
+  EXPECT_FALSE(outpaths.empty());
+  EXPECT_TRUE(ft.errors().empty()) << printLogMessages(ft.errors());
+
+  // Each written file is listed once
+  std::set<path> uniquePaths(outpaths.begin(), outpaths.end());
+  EXPECT_EQ(uniquePaths.size(), outpaths.size()) << printPaths(outpaths);
+  for (const auto& p : outpaths) {
+    EXPECT_TRUE(openstudio::filesystem::exists(p)) << toString(p);
+  }
+  EXPECT_TRUE(std::any_of(outpaths.begin(), outpaths.end(), [](const path& p) {
+    return p.parent_path().filename() == toPath("materials") && boost::starts_with(toString(p.filename()), "WG");
+  })) << printPaths(outpaths);
+
+  // The duplicated name has one geometry file, with the surfaces of one of the spaces and none of the other's
+  openstudio::path spaceFile = outpath / toPath("scene") / toPath("Duplicated_Space.rad");
+  EXPECT_EQ(1, std::count(outpaths.begin(), outpaths.end(), spaceFile)) << printPaths(outpaths);
+  ASSERT_TRUE(openstudio::filesystem::exists(spaceFile));
+  std::ifstream ifs(openstudio::toSystemFilename(spaceFile));
+  std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+  unsigned nSpaceHeaders = 0;
+  for (size_t pos = content.find("# geometry file for space:"); pos != std::string::npos; pos = content.find("# geometry file for space:", pos + 1)) {
+    ++nSpaceHeaders;
+  }
+  EXPECT_EQ(1u, nSpaceHeaders);
+
+  auto surfacesInFile = [&content](const Space& space) {
+    unsigned result = 0;
+    for (const auto& surface : space.surfaces()) {
+      std::string surfaceName = boost::algorithm::replace_all_copy(surface.nameString(), " ", "_");
+      if (content.find("# surface: " + surfaceName + "\n") != std::string::npos) {
+        ++result;
+      }
+    }
+    return result;
+  };
+  unsigned inFile0 = surfacesInFile(spaces[0]);
+  unsigned inFile1 = surfacesInFile(spaces[1]);
+  if (inFile0 > 0) {
+    EXPECT_EQ(spaces[0].surfaces().size(), inFile0);
+    EXPECT_EQ(0u, inFile1);
+  } else {
+    EXPECT_EQ(spaces[1].surfaces().size(), inFile1);
+  }
+}
+
 TEST(Radiance, ForwardTranslator_ExampleModel_NoIllumMaps) {
   Model model = exampleModel();
 
@@ -38,10 +38,12 @@
 
 #include <boost/algorithm/string/replace.hpp>
 
+#include <limits>
+
 namespace openstudio {
 
 LocalBCL::LocalBCL(const path& libraryPath)
-  : m_libraryPath(libraryPath.lexically_normal()), m_dbName("components.sql"), m_dbVersion("1.3"), m_connectionOpen(false) {
+  : m_libraryPath(libraryPath.lexically_normal()), m_dbName("components.sql"), m_dbVersion("1.3"), m_connectionOpen(false), m_searchIndexed(false) {
   //Check for BCL directory
   if (!openstudio::filesystem::is_directory(m_libraryPath) || !openstudio::filesystem::exists(m_libraryPath)) {
     openstudio::filesystem::create_directory(m_libraryPath);
@@ -321,6 +323,15 @@ bool LocalBCL::initializeLocalDb() {
 }
 
 bool LocalBCL::updateLocalDb() {
+  if (!migrateLocalDb()) {
+    return false;
+  }
+  // The search index is derived data: without FTS5 searches fall back to LIKE queries, so this cannot fail the update
+  updateSearchIndex();
+  return true;
+}
+
+bool LocalBCL::migrateLocalDb() {
 
   std::string localDbVersion;
 
@@ -655,6 +666,189 @@ bool LocalBCL::updateLocalDb() {
   return false;
 }
 
+namespace {
+
+// The full-text tables share their rowid with the Components / Measures row they index, the trigram tokenizer makes MATCH
+// behave like a case insensitive LIKE '%term%' on terms of three characters or more
+std::string searchTableName(const std::string& componentType) {
+  return (componentType == "component") ? "ComponentSearch" : "MeasureSearch";
+}
+
+std::string searchIndexInsertStatement(const std::string& componentType) {
+  std::string tableName = (componentType == "component") ? "Components" : "Measures";
+  std::string descriptionColumns = (componentType == "component") ? "description" : "description, modeler_description";
+  std::string selectedColumns = (componentType == "component") ? "t.description" : "t.description, t.modeler_description";
+  return "INSERT INTO " + searchTableName(componentType) + " (rowid, uid, version_id, name, " + descriptionColumns
+         + ", attributes) SELECT t.rowid, t.uid, t.version_id, t.name, " + selectedColumns
+         + ", (SELECT group_concat(a.name || ' ' || a.value, ' ') FROM Attributes a WHERE a.uid = t.uid AND a.version_id = t.version_id) FROM "
+         + tableName + " t";
+}
+
+}  // namespace
+
+void LocalBCL::updateSearchIndex() {
+  m_searchIndexed = false;
+
+  // Plain indexes first, these are used by the index rebuild below and by attributeSearch
+  std::string index_statements("CREATE INDEX IF NOT EXISTS AttributesUidIndex ON Attributes (uid, version_id);"
+                               "CREATE INDEX IF NOT EXISTS AttributesNameValueIndex ON Attributes (name COLLATE NOCASE, value COLLATE NOCASE);");
+  char* err = nullptr;
+  if (sqlite3_exec(m_db, index_statements.c_str(), nullptr, nullptr, &err) != SQLITE_OK) {
+    std::string errstr;
+    if (err) {
+      errstr = err;
+      sqlite3_free(err);
+    }
+    LOG(Warn, "Unable to create Attributes indexes: " << errstr);
+  }
+
+  std::string create_statements(
+    "CREATE VIRTUAL TABLE IF NOT EXISTS ComponentSearch USING fts5(uid UNINDEXED, version_id UNINDEXED, name, description, attributes, "
+    "tokenize='trigram');"
+    "CREATE VIRTUAL TABLE IF NOT EXISTS MeasureSearch USING fts5(uid UNINDEXED, version_id UNINDEXED, name, description, modeler_description, "
+    "attributes, tokenize='trigram');");
+  err = nullptr;
+  if (sqlite3_exec(m_db, create_statements.c_str(), nullptr, nullptr, &err) != SQLITE_OK) {
+    std::string errstr;
+    if (err) {
+      errstr = err;
+      sqlite3_free(err);
+    }
+    LOG(Warn, "Full-text search is not available, searches will scan the library: " << errstr);
+    return;
+  }
+
+  // Rebuild if the index does not match the tables, e.g. created just now, or entries added by a version without the index
+  bool inSync = false;
+  {
+    std::string statement("SELECT (SELECT count(*) FROM Components) = (SELECT count(*) FROM ComponentSearch) "
+                          "AND (SELECT count(*) FROM Measures) = (SELECT count(*) FROM MeasureSearch)");
+    sqlite3_stmt* sqlStmtPtr;
+    if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
+      LOG(Error, "Unable to prepare search index count Statement");
+      sqlite3_finalize(sqlStmtPtr);  // No-op
+      return;
+    }
+    if (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+      inSync = (sqlite3_column_int(sqlStmtPtr, 0) != 0);
+    }
+    sqlite3_finalize(sqlStmtPtr);
+  }
+
+  if (!inSync) {
+    if (!beginTransaction()) {
+      return;
+    }
+    std::string rebuild_statements = "DELETE FROM ComponentSearch; DELETE FROM MeasureSearch; " + searchIndexInsertStatement("component") + "; "
+                                     + searchIndexInsertStatement("measure") + ";";
+    if (sqlite3_exec(m_db, rebuild_statements.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
+      LOG(Error, "Unable to rebuild the search index, rolling back");
+      rollbackTransaction();
+      return;
+    }
+    if (!commitTransaction()) {
+      return;
+    }
+  }
+
+  m_searchIndexed = true;
+}
+
+bool LocalBCL::addToSearchIndex(const std::string& componentType, const std::string& uid, const std::string& versionId) {
+  if (!m_searchIndexed) {
+    return true;
+  }
+  std::string statement = searchIndexInsertStatement(componentType) + " WHERE t.uid='" + escape(uid) + "' AND t.version_id='" + escape(versionId) + "'";
+  if (sqlite3_exec(m_db, statement.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
+    LOG(Error, "Unable to add to the search index: " << statement);
+    return false;
+  }
+  return true;
+}
+
+bool LocalBCL::removeFromSearchIndex(const std::string& componentType, const std::string& uid, const std::string& versionId) {
+  if (!m_searchIndexed) {
+    return true;
+  }
+  std::string tableName = (componentType == "component") ? "Components" : "Measures";
+  std::string statement = "DELETE FROM " + searchTableName(componentType) + " WHERE rowid IN (SELECT rowid FROM " + tableName + " WHERE uid='"
+                          + escape(uid) + "' AND version_id='" + escape(versionId) + "')";
+  if (sqlite3_exec(m_db, statement.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
+    LOG(Error, "Unable to remove from the search index: " << statement);
+    return false;
+  }
+  return true;
+}
+
+std::vector<std::pair<std::string, std::string>> LocalBCL::searchUids(const std::string& searchTerm, const std::string& componentType,
+                                                                      unsigned limit, unsigned offset) const {
+  std::vector<std::pair<std::string, std::string>> result;
+
+  if (!m_db) {
+    return result;
+  }
+
+  std::string statement;
+  std::string pattern;
+  // trigrams need at least three characters, shorter terms (including the empty, match everything, term) use LIKE
+  if (m_searchIndexed && searchTerm.size() >= 3) {
+    // quote the term so that it is matched as a substring rather than parsed as an FTS5 query
+    pattern = "\"" + boost::replace_all_copy(searchTerm, "\"", "\"\"") + "\"";
+    std::string tableName = searchTableName(componentType);
+    // name matches rank above description matches, which rank above attribute matches
+    std::string weights = (componentType == "component") ? "0, 0, 10.0, 2.0, 1.0" : "0, 0, 10.0, 2.0, 2.0, 1.0";
+    statement = "SELECT uid, version_id FROM " + tableName + " WHERE " + tableName + " MATCH ?1 ORDER BY bm25(" + tableName + ", " + weights
+                + ") LIMIT ?2 OFFSET ?3";
+  } else {
+    pattern = "%" + searchTerm + "%";
+    if (componentType == "component") {
+      statement = "SELECT uid, version_id FROM Components WHERE name LIKE ?1 OR description LIKE ?1 ORDER BY (name LIKE ?1) DESC LIMIT ?2 OFFSET ?3";
+    } else {
+      statement = "SELECT uid, version_id FROM Measures WHERE name LIKE ?1 OR description LIKE ?1 OR modeler_description LIKE ?1 "
+                  "ORDER BY (name LIKE ?1) DESC LIMIT ?2 OFFSET ?3";
+    }
+  }
+
+  sqlite3_stmt* sqlStmtPtr;
+  int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
+  if (code != SQLITE_OK) {
+    LOG(Error, "Unable to prepare search Statement: " << statement);
+    sqlite3_finalize(sqlStmtPtr);  // No-op
+    return result;
+  }
+
+  // a negative LIMIT means no limit to SQLite
+  sqlite3_int64 sqlLimit = (limit == std::numeric_limits<unsigned>::max()) ? -1 : static_cast<sqlite3_int64>(limit);
+  if ((sqlite3_bind_text(sqlStmtPtr, 1, pattern.c_str(), pattern.size(), SQLITE_TRANSIENT) != SQLITE_OK)
+      || (sqlite3_bind_int64(sqlStmtPtr, 2, sqlLimit) != SQLITE_OK) || (sqlite3_bind_int64(sqlStmtPtr, 3, offset) != SQLITE_OK)) {
+    LOG(Error, "Error binding search parameters for: " << searchTerm);
+    sqlite3_finalize(sqlStmtPtr);
+    return result;
+  }
+
+  if (limit != std::numeric_limits<unsigned>::max()) {
+    result.reserve(limit);
+  }
+
+  // Loop until done (or failed)
+  while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
+  {
+    code = sqlite3_step(sqlStmtPtr);
+    if (code == SQLITE_ROW) {
+      // Get values from SELECT
+      result.emplace_back(columnText(sqlite3_column_text(sqlStmtPtr, 0)), columnText(sqlite3_column_text(sqlStmtPtr, 1)));
+    } else  // i didn't get a row.  something is wrong so set the exit condition.
+    {       // should never get here since i test for all documented return states above
+      code = SQLITE_DONE;
+    }
+  }  // End loop on each match
+
+  // Finalize statement to prevent memory leak
+  sqlite3_finalize(sqlStmtPtr);
+
+  return result;
+}
+
 /// Inherited members
 
 boost::optional<BCLComponent> LocalBCL::getComponent(const std::string& uid, const std::string& versionId) const {
@@ -907,110 +1101,43 @@ std::vector<std::string> LocalBCL::measureUids() const {
   return uids;
 }
 
-std::vector<BCLComponent> LocalBCL::searchComponents(const std::string& searchTerm, const std::string& /*componentType*/) const {
-  std::vector<BCLComponent> results;
-
-  if (m_db) {
-    std::string statement("SELECT uid, version_id FROM Components where name"
-                          "  LIKE \"%"
-                          + searchTerm + "%\" OR description LIKE \"%" + searchTerm + "%\"");
-    sqlite3_stmt* sqlStmtPtr;
-    if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-      LOG(Error, "Unable to prepare searchComponents Statement");
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return results;
-    }
-
-    int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-    if (code != SQLITE_OK) {
-      LOG(Error, "Unable to prepare searchComponents Statement: " << statement);
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return results;
-    }
-
-    // Loop until done (or failed)
-    while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
-    {
-      code = sqlite3_step(sqlStmtPtr);
-      if (code == SQLITE_ROW) {
-        // Get values from SELECT
-        std::string uid = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-        std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 1));
+std::vector<BCLComponent> LocalBCL::searchComponents(const std::string& searchTerm, const std::string& componentType) const {
+  return searchComponents(searchTerm, componentType, std::numeric_limits<unsigned>::max());
+}
 
-        boost::optional<BCLComponent> current(m_libraryPath / uid / version_id);
-        if (current) {
-          results.push_back(current.get());
-        }
-      } else  // i didn't get a row.  something is wrong so set the exit condition.
-      {       // should never get here since i test for all documented return states above
-        code = SQLITE_DONE;
-      }
-    }  // End loop on each match
+std::vector<BCLComponent> LocalBCL::searchComponents(const std::string& searchTerm, const unsigned /*componentTypeTID*/) const {
+  return searchComponents(searchTerm, "");
+}
 
-    // Finalize statement to prevent memory leak
-    sqlite3_finalize(sqlStmtPtr);
+std::vector<BCLComponent> LocalBCL::searchComponents(const std::string& searchTerm, const std::string& /*componentType*/, unsigned limit,
+                                                     unsigned offset) const {
+  std::vector<BCLComponent> results;
+  for (const auto& [uid, version_id] : searchUids(searchTerm, "component", limit, offset)) {
+    results.emplace_back(m_libraryPath / uid / version_id);
   }
-
   return results;
 }
 
-std::vector<BCLComponent> LocalBCL::searchComponents(const std::string& searchTerm, const unsigned /*componentTypeTID*/) const {
-  return searchComponents(searchTerm, "");
+std::vector<BCLMeasure> LocalBCL::searchMeasures(const std::string& searchTerm, const std::string& componentType) const {
+  return searchMeasures(searchTerm, componentType, std::numeric_limits<unsigned>::max());
 }
 
-std::vector<BCLMeasure> LocalBCL::searchMeasures(const std::string& searchTerm, const std::string& /*componentType*/) const {
+std::vector<BCLMeasure> LocalBCL::searchMeasures(const std::string& searchTerm, const unsigned /*componentTypeTID*/) const {
+  return searchMeasures(searchTerm, "");
+}
 
+std::vector<BCLMeasure> LocalBCL::searchMeasures(const std::string& searchTerm, const std::string& /*componentType*/, unsigned limit,
+                                                 unsigned offset) const {
   std::vector<BCLMeasure> results;
-
-  if (m_db) {
-    std::string statement("SELECT uid, version_id FROM Measures where name LIKE \"%" + searchTerm
-                          + "%\""
-                            "  OR description LIKE \"%"
-                          + searchTerm + "%\" OR modeler_description LIKE \"%" + searchTerm + "%\"");
-    sqlite3_stmt* sqlStmtPtr;
-    if (sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr) != SQLITE_OK) {
-      LOG(Error, "Unable to prepare searchMeasures Statement");
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return results;
-    }
-
-    int code = sqlite3_prepare_v2(m_db, statement.c_str(), -1, &sqlStmtPtr, nullptr);
-    if (code != SQLITE_OK) {
-      LOG(Error, "Unable to prepare searchMeasures Statement: " << statement);
-      sqlite3_finalize(sqlStmtPtr);  // No-op
-      return results;
+  for (const auto& [uid, version_id] : searchUids(searchTerm, "measure", limit, offset)) {
+    boost::optional<BCLMeasure> current = BCLMeasure::load(m_libraryPath / uid / version_id);
+    if (current) {
+      results.push_back(current.get());
     }
-
-    // Loop until done (or failed)
-    while ((code != SQLITE_DONE) && (code != SQLITE_BUSY) && (code != SQLITE_ERROR) && (code != SQLITE_MISUSE))  //loop until SQLITE_DONE
-    {
-      code = sqlite3_step(sqlStmtPtr);
-      if (code == SQLITE_ROW) {
-        // Get values from SELECT
-        std::string uid = columnText(sqlite3_column_text(sqlStmtPtr, 0));
-        std::string version_id = columnText(sqlite3_column_text(sqlStmtPtr, 1));
-
-        boost::optional<BCLMeasure> current = BCLMeasure::load(m_libraryPath / uid / version_id);
-        if (current) {
-          results.push_back(current.get());
-        }
-      } else  // i didn't get a row.  something is wrong so set the exit condition.
-      {       // should never get here since i test for all documented return states above
-        code = SQLITE_DONE;
-      }
-    }  // End loop on each match
-
-    // Finalize statement to prevent memory leak
-    sqlite3_finalize(sqlStmtPtr);
   }
-
   return results;
 }
 
-std::vector<BCLMeasure> LocalBCL::searchMeasures(const std::string& searchTerm, const unsigned /*componentTypeTID*/) const {
-  return searchMeasures(searchTerm, "");
-}
-
 /// Class members
 
 // cppcheck-suppress constParameter
@@ -1026,6 +1153,11 @@ bool LocalBCL::addComponent(BCLComponent& component) {
     std::string uid = component.uid();
     std::string versionId = component.versionId();
 
+    if (!removeFromSearchIndex("component", uid, versionId)) {
+      rollbackTransaction();
+      return false;
+    }
+
     std::string statement = "DELETE FROM Components WHERE uid='" + escape(uid) + "' AND version_id='" + escape(versionId) + "'";
     if (sqlite3_exec(m_db, statement.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
       // Rollback changes
@@ -1119,6 +1251,11 @@ bool LocalBCL::addComponent(BCLComponent& component) {
       }
     }  // End insert each attribute
 
+    if (!addToSearchIndex("component", uid, versionId)) {
+      rollbackTransaction();
+      return false;
+    }
+
     // Commit changes now that everything went well
     return commitTransaction();
 
@@ -1146,6 +1283,11 @@ bool LocalBCL::removeComponent(BCLComponent& component) {
   std::string uid = component.uid();
   std::string versionId = component.versionId();
 
+  if (!removeFromSearchIndex("component", uid, versionId)) {
+    rollbackTransaction();
+    return false;
+  }
+
   std::string statement("DELETE FROM Components WHERE uid='" + escape(uid) + "' AND version_id='" + escape(versionId)
                         + "';"
                           "DELETE FROM Files WHERE uid='"
@@ -1215,6 +1357,11 @@ bool LocalBCL::addMeasure(BCLMeasure& measure) {
   std::string uid = measure.uid();
   std::string versionId = measure.versionId();
 
+  if (!removeFromSearchIndex("measure", uid, versionId)) {
+    rollbackTransaction();
+    return false;
+  }
+
   std::string statement = "DELETE FROM Measures WHERE uid='" + escape(uid) + "' AND version_id='" + escape(versionId) + "'";
   if (sqlite3_exec(m_db, statement.c_str(), nullptr, nullptr, nullptr) != SQLITE_OK) {
     // Rollback changes
@@ -1306,6 +1453,11 @@ bool LocalBCL::addMeasure(BCLMeasure& measure) {
     }
   }  // End insert each attribute
 
+  if (!addToSearchIndex("measure", uid, versionId)) {
+    rollbackTransaction();
+    return false;
+  }
+
   // Commit changes now that everything went well
   return commitTransaction();
 }
@@ -1331,6 +1483,11 @@ bool LocalBCL::removeMeasure(BCLMeasure& measure) {
   std::string uid = measure.uid();
   std::string versionId = measure.versionId();
 
+  if (!removeFromSearchIndex("measure", uid, versionId)) {
+    rollbackTransaction();
+    return false;
+  }
+
   std::string statement("DELETE FROM Measures WHERE uid='" + escape(uid) + "' AND version_id='" + escape(versionId)
                         + "';"
                           "DELETE FROM Files WHERE uid='"
@@ -102,6 +102,15 @@ class UTILITIES_API LocalBCL : public BCL
   virtual std::vector<BCLMeasure> searchMeasures(const std::string& searchTerm, const std::string& componentType) const;
   virtual std::vector<BCLMeasure> searchMeasures(const std::string& searchTerm, const unsigned componentTypeTID) const;
 
+  /// Perform a ranked component search of the library, returning at most limit results after skipping the first offset ones.
+  /// Name, description and attributes are searched through the full-text index when the term is at least three characters long
+  std::vector<BCLComponent> searchComponents(const std::string& searchTerm, const std::string& componentType, unsigned limit,
+                                             unsigned offset = 0) const;
+
+  /// Perform a ranked measure search of the library, returning at most limit results after skipping the first offset ones
+  std::vector<BCLMeasure> searchMeasures(const std::string& searchTerm, const std::string& componentType, unsigned limit,
+                                         unsigned offset = 0) const;
+
   //@}
   /** @name Class members */
   //@{
@@ -161,6 +170,19 @@ class UTILITIES_API LocalBCL : public BCL
 
   bool updateLocalDb();
 
+  bool migrateLocalDb();
+
+  // Creates the full-text search tables if the SQLite build supports FTS5, and rebuilds them if they are out of sync
+  void updateSearchIndex();
+
+  // Both must be called within the transaction that adds or removes the component or measure
+  bool addToSearchIndex(const std::string& componentType, const std::string& uid, const std::string& versionId);
+  bool removeFromSearchIndex(const std::string& componentType, const std::string& uid, const std::string& versionId);
+
+  // Returns (uid, version_id) pairs, best matches first
+  std::vector<std::pair<std::string, std::string>> searchUids(const std::string& searchTerm, const std::string& componentType, unsigned limit,
+                                                              unsigned offset) const;
+
   bool validateProdAuthKey(const std::string& authKey);
   bool validateDevAuthKey(const std::string& authKey);
 
@@ -179,6 +201,7 @@ class UTILITIES_API LocalBCL : public BCL
   const openstudio::path m_dbName;
   const std::string m_dbVersion;
   bool m_connectionOpen;
+  bool m_searchIndexed;
 
   std::string m_prodAuthKey;
   std::string m_devAuthKey;
@@ -48,6 +48,50 @@ TEST_F(BCLFixture, LocalBCL_AuthKey) {
   //EXPECT_EQ(defaultDevAuthKey, LocalBCL::instance().devAuthKey());
 }
 
+TEST_F(BCLFixture, LocalBCL_SearchMeasures) {
+  LocalBCL& localBCL = LocalBCL::instance();
+
+  // measures are loaded from <library>/<uid>/<version_id>, so create them elsewhere and clone them in
+  auto addMeasure = [this, &localBCL](const std::string& name, const std::string& description) {
+    BCLMeasure source(name, BCLMeasure::makeClassName(name), currentLocalBCLPath / toPath("sources") / toPath(BCLMeasure::makeClassName(name)),
+                      "Envelope.Fenestration", MeasureType::ModelMeasure, description, "Modeler Description");
+    boost::optional<BCLMeasure> measure = source.clone(currentLocalBCLPath / toPath(source.uid()) / toPath(source.versionId()));
+    EXPECT_TRUE(measure);
+    EXPECT_TRUE(measure && localBCL.addMeasure(*measure));
+    return source.uid();
+  };
+  std::string overhangs = addMeasure("Add Overhangs", "Adds overhangs above each window");
+  std::string windows = addMeasure("Reduce Window Area", "Shrinks windows, a cheaper alternative to overhangs");
+
+  std::vector<BCLMeasure> results = localBCL.searchMeasures("OVERHANG", "");
+  ASSERT_EQ(2u, results.size());
+  // name matches rank first
+  EXPECT_EQ(overhangs, results[0].uid());
+  EXPECT_EQ(windows, results[1].uid());
+
+  // pages
+  results = localBCL.searchMeasures("overhang", "", 1);
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(overhangs, results[0].uid());
+  results = localBCL.searchMeasures("overhang", "", 1, 1);
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(windows, results[0].uid());
+  EXPECT_TRUE(localBCL.searchMeasures("overhang", "", 1, 2).empty());
+
+  // short and empty terms
+  EXPECT_EQ(1u, localBCL.searchMeasures("ad", "").size());
+  EXPECT_EQ(2u, localBCL.searchMeasures("", "").size());
+  EXPECT_TRUE(localBCL.searchMeasures("skylight", "").empty());
+
+  // removed measures drop out of the results
+  boost::optional<BCLMeasure> measure = localBCL.getMeasure(windows);
+  ASSERT_TRUE(measure);
+  EXPECT_TRUE(localBCL.removeMeasure(*measure));
+  results = localBCL.searchMeasures("overhang", "");
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(overhangs, results[0].uid());
+}
+
 TEST_F(BCLFixture, RemoteBCLTest) {
   RemoteBCL remoteBCL;
 
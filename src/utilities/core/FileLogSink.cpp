@@ -38,8 +38,9 @@ namespace openstudio {
 
 namespace detail {
 
-  FileLogSink_Impl::FileLogSink_Impl(const openstudio::path& path)
-    : m_path{path}, m_ofs{boost::shared_ptr<openstudio::filesystem::ofstream>(new openstudio::filesystem::ofstream(path))} {
+  FileLogSink_Impl::FileLogSink_Impl(const openstudio::path& path, bool asynchronous)
+    : LogSink_Impl(asynchronous),
+      m_path{path}, m_ofs{boost::shared_ptr<openstudio::filesystem::ofstream>(new openstudio::filesystem::ofstream(path))} {
     this->setStream(m_ofs);
     this->enable();
   }
@@ -56,6 +57,9 @@ namespace detail {
   }
 
   std::vector<LogMessage> FileLogSink_Impl::logMessages() const {
+    // write out anything still queued or buffered before reading the file back
+    const_cast<FileLogSink_Impl*>(this)->flush();
+
     openstudio::filesystem::ifstream ifs(m_path);
     std::string line;
     std::string text;
@@ -70,6 +74,11 @@ FileLogSink::FileLogSink(const openstudio::path& path) : LogSink(boost::shared_p
   OS_ASSERT(getImpl<detail::FileLogSink_Impl>());
 }
 
+FileLogSink::FileLogSink(const openstudio::path& path, bool asynchronous)
+  : LogSink(boost::shared_ptr<detail::FileLogSink_Impl>(new detail::FileLogSink_Impl(path, asynchronous))) {
+  OS_ASSERT(getImpl<detail::FileLogSink_Impl>());
+}
+
 openstudio::path FileLogSink::path() const {
   return this->getImpl<detail::FileLogSink_Impl>()->path();
 }
@@ -44,6 +44,10 @@ class UTILITIES_API FileLogSink : public LogSink
   /// and registers in the global logger
   FileLogSink(const openstudio::path& path);
 
+  /// if asynchronous, messages are queued by the logging thread and written in batches by a dedicated thread,
+  /// they reach the file when the sink is flushed or disabled, when logMessages is called, or at exit
+  FileLogSink(const openstudio::path& path, bool asynchronous);
+
   /// returns the path that log messages are written to
   openstudio::path path() const;
 
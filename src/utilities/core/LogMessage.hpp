@@ -63,6 +63,9 @@ namespace openstudio {
 /// LogChannel identifies a logger
 using LogChannel = std::string;
 
+/// Base type of the sink frontends registered in the logging core
+using LogSinkFrontend = boost::log::sinks::sink;
+
 /// Type of stream sink used
 using LogSinkBackend = boost::log::sinks::synchronous_sink<boost::log::sinks::text_ostream_backend>;
 
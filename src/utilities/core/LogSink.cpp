@@ -43,18 +43,32 @@ namespace openstudio {
 
 namespace detail {
 
-  LogSink_Impl::LogSink_Impl() : m_mutex{}, m_threadId{}, m_sink{boost::shared_ptr<LogSinkBackend>(new LogSinkBackend())} {}
+  LogSink_Impl::LogSink_Impl() : LogSink_Impl(false) {}
+
+  LogSink_Impl::LogSink_Impl(bool asynchronous) : m_mutex{}, m_threadId{} {
+    if (asynchronous) {
+      m_asyncSink = boost::shared_ptr<AsyncLogSinkBackend>(new AsyncLogSinkBackend());
+    } else {
+      m_sink = boost::shared_ptr<LogSinkBackend>(new LogSinkBackend());
+    }
+    // a new sink accepts everything until a filter is set
+    LoggerSingleton::setSinkFilter(this->sink(), Trace, boost::none);
+  }
+
+  LogSink_Impl::~LogSink_Impl() {
+    LoggerSingleton::removeSinkFilter(this->sink());
+  }
 
   bool LogSink_Impl::isEnabled() const {
-    return Logger::instance().findSink(m_sink);
+    return Logger::instance().findSink(this->sink());
   }
 
   void LogSink_Impl::enable() {
-    Logger::instance().addSink(m_sink);
+    Logger::instance().addSink(this->sink());
   }
 
   void LogSink_Impl::disable() {
-    Logger::instance().removeSink(m_sink);
+    Logger::instance().removeSink(this->sink());
   }
 
   boost::optional<LogLevel> LogSink_Impl::logLevel() const {
@@ -117,7 +131,7 @@ namespace detail {
 
     m_autoFlush = autoFlush;
 
-    m_sink->locked_backend()->auto_flush(autoFlush);
+    visitSink([autoFlush](auto& sink) { sink.locked_backend()->auto_flush(autoFlush); });
   }
 
   std::thread::id LogSink_Impl::threadId() const {
@@ -142,17 +156,27 @@ namespace detail {
     this->updateFilter(l);
   }
 
+  bool LogSink_Impl::isAsynchronous() const {
+    return static_cast<bool>(m_asyncSink);
+  }
+
+  void LogSink_Impl::flush() {
+    visitSink([](auto& sink) { sink.flush(); });
+  }
+
   void LogSink_Impl::setStream(boost::shared_ptr<std::ostream> os) {
     std::unique_lock l{m_mutex};
 
-    m_sink->locked_backend()->add_stream(os);
+    visitSink([&os](auto& sink) {
+      sink.locked_backend()->add_stream(os);
 
-    // set formatting, seems like you have to call this after the stream is added
-    // DLM@20110701: would like to format Severity as string but can't figure out how to do it
-    // because you can't overload operator<< for an enum type
-    // this seems to suggest this should work: http://www.edm2.com/0405/enumeration.html
-    m_sink->set_formatter(expr::stream << "[" << expr::attr<LogChannel>("Channel") << "] <" << expr::attr<LogLevel>("Severity") << "> "
-                                       << expr::smessage);
+      // set formatting, seems like you have to call this after the stream is added
+      // DLM@20110701: would like to format Severity as string but can't figure out how to do it
+      // because you can't overload operator<< for an enum type
+      // this seems to suggest this should work: http://www.edm2.com/0405/enumeration.html
+      sink.set_formatter(expr::stream << "[" << expr::attr<LogChannel>("Channel") << "] <" << expr::attr<LogLevel>("Severity") << "> "
+                                      << expr::smessage);
+    });
 
     //m_sink->locked_backend()->set_formatter(fmt::stream
     //  << "[" << fmt::attr< LogChannel >("Channel")
@@ -164,17 +188,19 @@ namespace detail {
     // avoid deadlock
     l.unlock();
 
-    this->setAutoFlush(true);
+    // asynchronous sinks batch writes, the stream is flushed by flush() or when the sink is disabled
+    this->setAutoFlush(!isAsynchronous());
   }
 
-  boost::shared_ptr<LogSinkBackend> LogSink_Impl::sink() const {
-    std::shared_lock l{m_mutex};
-
+  boost::shared_ptr<LogSinkFrontend> LogSink_Impl::sink() const {
+    if (m_asyncSink) {
+      return m_asyncSink;
+    }
     return m_sink;
   }
 
   void LogSink_Impl::updateFilter(const std::unique_lock<std::shared_mutex>& /*l*/) {
-    m_sink->reset_filter();
+    visitSink([](auto& sink) { sink.reset_filter(); });
 
     LogLevel filterLogLevel = Trace;
     if (m_logLevel) {
@@ -187,11 +213,18 @@ namespace detail {
     }
 
     if (m_threadId != std::thread::id{}) {
-      m_sink->set_filter(expr::attr<LogLevel>("Severity") >= filterLogLevel && expr::attr<std::thread::id>("ThreadId") == m_threadId
-                         && expr::matches(expr::attr<LogChannel>("Channel"), filterChannelRegex));
+      visitSink([&](auto& sink) {
+        sink.set_filter(expr::attr<LogLevel>("Severity") >= filterLogLevel && expr::attr<std::thread::id>("ThreadId") == m_threadId
+                        && expr::matches(expr::attr<LogChannel>("Channel"), filterChannelRegex));
+      });
     } else {
-      m_sink->set_filter(expr::attr<LogLevel>("Severity") >= filterLogLevel && expr::matches(expr::attr<LogChannel>("Channel"), filterChannelRegex));
+      visitSink([&](auto& sink) {
+        sink.set_filter(expr::attr<LogLevel>("Severity") >= filterLogLevel && expr::matches(expr::attr<LogChannel>("Channel"), filterChannelRegex));
+      });
     }
+
+    // let the macros skip formatting messages this sink would drop
+    LoggerSingleton::setSinkFilter(this->sink(), filterLogLevel, m_channelRegex);
   }
 
 }  // namespace detail
@@ -264,7 +297,15 @@ void LogSink::setStream(boost::shared_ptr<std::ostream> os) {
   m_impl->setStream(os);
 }
 
-boost::shared_ptr<LogSinkBackend> LogSink::sink() const {
+bool LogSink::isAsynchronous() const {
+  return m_impl->isAsynchronous();
+}
+
+void LogSink::flush() {
+  m_impl->flush();
+}
+
+boost::shared_ptr<LogSinkFrontend> LogSink::sink() const {
   return m_impl->sink();
 }
 
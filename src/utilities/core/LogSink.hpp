@@ -95,6 +95,12 @@ class UTILITIES_API LogSink
   /// reset the thread id that messages are filtered by
   void resetThreadId();
 
+  /// are messages queued and written in batches by a dedicated thread
+  bool isAsynchronous() const;
+
+  /// blocks until queued messages have been written and flushes the stream
+  void flush();
+
  protected:
   friend class LoggerSingleton;
 
@@ -108,7 +114,7 @@ class UTILITIES_API LogSink
   void setStream(boost::shared_ptr<std::ostream> os);
 
   // for adding cout and cerr sinks to logger
-  boost::shared_ptr<LogSinkBackend> sink() const;
+  boost::shared_ptr<LogSinkFrontend> sink() const;
 
   // get the impl
   template <typename T>
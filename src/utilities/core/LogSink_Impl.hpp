@@ -36,11 +36,15 @@
 #include "LogSink.hpp"
 
 #include <boost/optional.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
 
 #include <shared_mutex>
 
 namespace openstudio {
 
+/// Type of stream sink used by asynchronous sinks, records are queued by the logging thread and written by a dedicated thread
+using AsyncLogSinkBackend = boost::log::sinks::asynchronous_sink<boost::log::sinks::text_ostream_backend>;
+
 namespace detail {
 
   /// LogSink is a class for managing sinks for log messages, e.g. files, streams, etc.
@@ -48,7 +52,7 @@ namespace detail {
   {
    public:
     /// destructor
-    virtual ~LogSink_Impl() = default;
+    virtual ~LogSink_Impl();
 
     /// is the sink enabled
     bool isEnabled() const;
@@ -95,28 +99,48 @@ namespace detail {
     /// reset the thread id that messages are filtered by
     void resetThreadId();
 
+    /// are messages written by a dedicated thread
+    bool isAsynchronous() const;
+
+    /// blocks until queued messages have been written and flushes the stream
+    void flush();
+
    protected:
     friend class openstudio::LogSink;
 
     // does not register in the global logger
     LogSink_Impl();
 
+    // does not register in the global logger, an asynchronous sink queues messages and writes them in batches on its own thread
+    explicit LogSink_Impl(bool asynchronous);
+
     // must be set in the constructor
     void setStream(boost::shared_ptr<std::ostream> os);
 
     // for adding cout and cerr sinks to logger
-    boost::shared_ptr<LogSinkBackend> sink() const;
+    boost::shared_ptr<LogSinkFrontend> sink() const;
 
     mutable std::shared_mutex m_mutex;
 
    private:
     void updateFilter(const std::unique_lock<std::shared_mutex>& l);
 
+    // calls f with whichever of the synchronous or asynchronous frontends this sink uses
+    template <typename Function>
+    void visitSink(Function&& f) const {
+      if (m_asyncSink) {
+        f(*m_asyncSink);
+      } else {
+        f(*m_sink);
+      }
+    }
+
     boost::optional<LogLevel> m_logLevel;
     boost::optional<boost::regex> m_channelRegex;
     bool m_autoFlush = false;
     std::thread::id m_threadId;
     boost::shared_ptr<LogSinkBackend> m_sink;
+    boost::shared_ptr<AsyncLogSinkBackend> m_asyncSink;
   };
 
 }  // namespace detail
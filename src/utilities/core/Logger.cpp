@@ -34,13 +34,77 @@
 
 #include <boost/core/null_deleter.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <unordered_map>
+
 namespace sinks = boost::log::sinks;
 namespace keywords = boost::log::keywords;
 
 namespace openstudio {
 
+namespace {
+
+  // no sink accepts messages at or below this level
+  constexpr int noLogLevel = std::numeric_limits<int>::max();
+
+  // lowest level accepted by any enabled sink, starts permissive so the first message constructs the LoggerSingleton
+  std::atomic<int> minimumEnabledLevel{Trace};
+
+  // mirrors the level and channel filters of each sink, so messages can be rejected before they are formatted
+  struct SinkFilters
+  {
+    struct SinkFilter
+    {
+      LogLevel logLevel = Trace;
+      boost::optional<boost::regex> channelRegex;
+      bool enabled = false;
+    };
+
+    std::shared_mutex mutex;
+    std::map<const LogSinkFrontend*, SinkFilter> filters;
+    // lowest level accepted on each channel, filled in lazily and cleared whenever a filter changes
+    std::unordered_map<std::string, int> channelThresholds;
+
+    // requires a unique lock on mutex
+    void update() {
+      int minimumLevel = noLogLevel;
+      for (const auto& [sink, filter] : filters) {
+        if (filter.enabled) {
+          minimumLevel = std::min(minimumLevel, static_cast<int>(filter.logLevel));
+        }
+      }
+      channelThresholds.clear();
+      minimumEnabledLevel.store(minimumLevel, std::memory_order_relaxed);
+    }
+
+    // requires a lock on mutex
+    int channelThreshold(const LogChannel& logChannel) const {
+      int result = noLogLevel;
+      for (const auto& [sink, filter] : filters) {
+        // thread id filters are not mirrored, a sink filtering by thread is treated as accepting every thread
+        if (filter.enabled && (!filter.channelRegex || boost::regex_match(logChannel, *filter.channelRegex))) {
+          result = std::min(result, static_cast<int>(filter.logLevel));
+        }
+      }
+      return result;
+    }
+  };
+
+  SinkFilters& sinkFilters() {
+    // intentionally leaked, messages may still be logged while other statics are destroyed
+    static auto* result = new SinkFilters();
+    return *result;
+  }
+
+}  // namespace
+
 /// convenience function for SWIG, prefer macros in C++
 void logFree(LogLevel level, const std::string& channel, const std::string& message) {
+  if (!LoggerSingleton::isLevelEnabled(level) || !LoggerSingleton::isChannelEnabled(level, channel)) {
+    return;
+  }
   BOOST_LOG_SEV(openstudio::Logger::instance().loggerFromChannel(channel), level) << message;
 }
 
@@ -62,6 +126,9 @@ LoggerSingleton::LoggerSingleton() {
 }
 
 LoggerSingleton::~LoggerSingleton() {
+  // write out anything still queued for asynchronous sinks
+  flush();
+
   // unregister Qt message handler
   //qInstallMsgHandler(consoleLogQtMessage);
 }
@@ -101,7 +168,60 @@ LoggerType& LoggerSingleton::loggerFromChannel(const LogChannel& logChannel) {
   return it->second;
 }
 
-bool LoggerSingleton::findSink(boost::shared_ptr<LogSinkBackend> sink) {
+bool LoggerSingleton::isLevelEnabled(LogLevel level) {
+  return static_cast<int>(level) >= minimumEnabledLevel.load(std::memory_order_relaxed);
+}
+
+bool LoggerSingleton::isChannelEnabled(LogLevel level, const LogChannel& logChannel) {
+  // make sure the standard out sink is registered before deciding nothing listens
+  Logger::instance();
+
+  SinkFilters& sinkFilters = openstudio::sinkFilters();
+  std::shared_lock l{sinkFilters.mutex};
+
+  auto it = sinkFilters.channelThresholds.find(logChannel);
+  if (it != sinkFilters.channelThresholds.end()) {
+    return static_cast<int>(level) >= it->second;
+  }
+
+  l.unlock();
+  std::unique_lock l2{sinkFilters.mutex};
+
+  int threshold = sinkFilters.channelThreshold(logChannel);
+  sinkFilters.channelThresholds.emplace(logChannel, threshold);
+  return static_cast<int>(level) >= threshold;
+}
+
+void LoggerSingleton::setSinkFilter(const boost::shared_ptr<LogSinkFrontend>& sink, LogLevel logLevel,
+                                    const boost::optional<boost::regex>& channelRegex) {
+  SinkFilters& sinkFilters = openstudio::sinkFilters();
+  std::unique_lock l{sinkFilters.mutex};
+
+  SinkFilters::SinkFilter& filter = sinkFilters.filters[sink.get()];
+  filter.logLevel = logLevel;
+  filter.channelRegex = channelRegex;
+  sinkFilters.update();
+}
+
+void LoggerSingleton::removeSinkFilter(const boost::shared_ptr<LogSinkFrontend>& sink) {
+  SinkFilters& sinkFilters = openstudio::sinkFilters();
+  std::unique_lock l{sinkFilters.mutex};
+
+  auto it = sinkFilters.filters.find(sink.get());
+  if (it != sinkFilters.filters.end() && !it->second.enabled) {
+    sinkFilters.filters.erase(it);
+  }
+}
+
+void LoggerSingleton::flush() {
+  std::shared_lock l{m_mutex};
+
+  for (const auto& sink : m_sinks) {
+    sink->flush();
+  }
+}
+
+bool LoggerSingleton::findSink(boost::shared_ptr<LogSinkFrontend> sink) {
   std::unique_lock l{m_mutex};
 
   auto it = m_sinks.find(sink);
@@ -109,7 +229,7 @@ bool LoggerSingleton::findSink(boost::shared_ptr<LogSinkBackend> sink) {
   return (it != m_sinks.end());
 }
 
-void LoggerSingleton::addSink(boost::shared_ptr<LogSinkBackend> sink) {
+void LoggerSingleton::addSink(boost::shared_ptr<LogSinkFrontend> sink) {
   std::shared_lock l{m_mutex};
 
   auto it = m_sinks.find(sink);
@@ -124,10 +244,15 @@ void LoggerSingleton::addSink(boost::shared_ptr<LogSinkBackend> sink) {
 
     // Register the sink in the logging core
     boost::log::core::get()->add_sink(sink);
+
+    SinkFilters& sinkFilters = openstudio::sinkFilters();
+    std::unique_lock l3{sinkFilters.mutex};
+    sinkFilters.filters[sink.get()].enabled = true;
+    sinkFilters.update();
   }
 }
 
-void LoggerSingleton::removeSink(boost::shared_ptr<LogSinkBackend> sink) {
+void LoggerSingleton::removeSink(boost::shared_ptr<LogSinkFrontend> sink) {
   std::shared_lock l{m_mutex};
 
   auto it = m_sinks.find(sink);
@@ -142,6 +267,16 @@ void LoggerSingleton::removeSink(boost::shared_ptr<LogSinkBackend> sink) {
 
     // Register the sink in the logging core
     boost::log::core::get()->remove_sink(sink);
+
+    {
+      SinkFilters& sinkFilters = openstudio::sinkFilters();
+      std::unique_lock l3{sinkFilters.mutex};
+      sinkFilters.filters[sink.get()].enabled = false;
+      sinkFilters.update();
+    }
+
+    // anything already queued for an asynchronous sink is still written out
+    sink->flush();
   }
 }
 
@@ -37,6 +37,8 @@
 #include "Compare.hpp"
 #include "LogSink.hpp"
 
+#include <boost/optional.hpp>
+#include <boost/regex.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include <sstream>
@@ -56,12 +58,17 @@
 /// log a message from within a registered class and throw an exception
 #define LOG_AND_THROW(__message__) LOG_FREE_AND_THROW(logChannel(), __message__);
 
-/// log a message from outside a registered class
-#define LOG_FREE(__level__, __channel__, __message__)        \
-  {                                                          \
-    std::stringstream _ss1;                                  \
-    _ss1 << __message__;                                     \
-    openstudio::logFree(__level__, __channel__, _ss1.str()); \
+/// log a message from outside a registered class, the message is only formatted if an enabled sink accepts the level and channel
+#define LOG_FREE(__level__, __channel__, __message__)                                         \
+  {                                                                                           \
+    if (openstudio::LoggerSingleton::isLevelEnabled(__level__)) {                             \
+      const openstudio::LogChannel& _channel1 = __channel__;                                  \
+      if (openstudio::LoggerSingleton::isChannelEnabled(__level__, _channel1)) {              \
+        std::stringstream _ss1;                                                               \
+        _ss1 << __message__;                                                                  \
+        openstudio::logFree(__level__, _channel1, _ss1.str());                                \
+      }                                                                                       \
+    }                                                                                         \
   }
 
 /// log a message from outside a registered class and throw an exception
@@ -100,17 +107,34 @@ class UTILITIES_API LoggerSingleton
   /// exist a new logger will be set up at the default level
   LoggerType& loggerFromChannel(const LogChannel& logChannel);
 
+  /// returns false if no enabled sink accepts messages at this level, on any channel
+  /// this is a single relaxed atomic load, so it is checked before a message is formatted
+  static bool isLevelEnabled(LogLevel level);
+
+  /// returns false if no enabled sink accepts messages at this level on this channel, results are cached per channel
+  static bool isChannelEnabled(LogLevel level, const LogChannel& logChannel);
+
+  /// blocks until all messages queued for asynchronous sinks have been written
+  void flush();
+
  protected:
   friend class detail::LogSink_Impl;
 
   /// is the sink found in the logging core
-  bool findSink(boost::shared_ptr<LogSinkBackend> sink);
+  bool findSink(boost::shared_ptr<LogSinkFrontend> sink);
 
   /// adds a sink to the logging core, equivalent to logSink.enable()
-  void addSink(boost::shared_ptr<LogSinkBackend> sink);
+  void addSink(boost::shared_ptr<LogSinkFrontend> sink);
 
   /// removes a sink to the logging core, equivalent to logSink.disable()
-  void removeSink(boost::shared_ptr<LogSinkBackend> sink);
+  void removeSink(boost::shared_ptr<LogSinkFrontend> sink);
+
+  /// records the level and channel filter of a sink so that messages no enabled sink accepts are never formatted,
+  /// static so that sinks owned by the singleton can call it while it is being constructed
+  static void setSinkFilter(const boost::shared_ptr<LogSinkFrontend>& sink, LogLevel logLevel, const boost::optional<boost::regex>& channelRegex);
+
+  /// forgets the filter of a sink that is being destroyed, unless the sink is still in the logging core which keeps it alive
+  static void removeSinkFilter(const boost::shared_ptr<LogSinkFrontend>& sink);
 
  private:
   /// private constructor
@@ -129,7 +153,7 @@ class UTILITIES_API LoggerSingleton
   LoggerMapType m_loggerMap;
 
   /// current sinks, kept here so don't destruct when LogSink wrapper goes out of scope
-  using SinkSetType = std::set<boost::shared_ptr<LogSinkBackend>>;
+  using SinkSetType = std::set<boost::shared_ptr<LogSinkFrontend>>;
   SinkSetType m_sinks;
 };
 
@@ -31,6 +31,10 @@
 #include "String.hpp"
 #include "StaticInitializer.hpp"
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <random>
 #include <sstream>
 
 #include <boost/uuid/uuid_io.hpp>
@@ -39,6 +43,100 @@
 
 namespace openstudio {
 
+namespace {
+
+  // Bumped by setUUIDSeed and clearUUIDSeed so that each thread reseeds its generator on its next call
+  std::atomic<std::uint64_t> uuidSeedEpoch{0};
+  std::atomic<bool> uuidSeeded{false};
+  std::atomic<std::uint64_t> uuidSeed{0};
+  // Number of threads that have been seeded from uuidSeed since it was set, used to give each of them their own sequence
+  std::atomic<std::uint64_t> uuidSeededThreads{0};
+
+  std::uint64_t splitMix64(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  /** Version 4 UUID generator, one per thread. Uses xoshiro256** (Blackman and Vigna) which is much cheaper than the Mersenne Twister or the
+   *  OS entropy source used by boost::uuids::random_generator. Handles only need to be unique, not unpredictable. UUIDs are made in
+   *  batches so that the generator state stays in registers while the buffer is filled. */
+  class FastUUIDGenerator
+  {
+   public:
+    boost::uuids::uuid operator()() {
+      const std::uint64_t epoch = uuidSeedEpoch.load(std::memory_order_acquire);
+      if (epoch != m_epoch || !m_initialized) {
+        seed(epoch);
+      }
+      if (m_next == m_batch.size()) {
+        fillBatch();
+      }
+      return m_batch[m_next++];
+    }
+
+   private:
+    static constexpr size_t batchSize = 16;
+
+    void seed(std::uint64_t epoch) {
+      std::uint64_t seedState = 0;
+      if (uuidSeeded.load(std::memory_order_acquire)) {
+        const std::uint64_t threadOrdinal = uuidSeededThreads.fetch_add(1, std::memory_order_relaxed);
+        seedState = uuidSeed.load(std::memory_order_relaxed) ^ (threadOrdinal * 0xD1B54A32D192ED03ULL);
+      } else {
+        std::random_device rd;
+        seedState = (static_cast<std::uint64_t>(rd()) << 32) ^ static_cast<std::uint64_t>(rd());
+        seedState ^= reinterpret_cast<std::uintptr_t>(this);
+      }
+      for (auto& s : m_state) {
+        s = splitMix64(seedState);
+      }
+      m_epoch = epoch;
+      m_initialized = true;
+      m_next = m_batch.size();
+    }
+
+    static std::uint64_t rotl(std::uint64_t x, int k) {
+      return (x << k) | (x >> (64 - k));
+    }
+
+    std::uint64_t nextRandom() {
+      const std::uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+      const std::uint64_t t = m_state[1] << 17;
+      m_state[2] ^= m_state[0];
+      m_state[3] ^= m_state[1];
+      m_state[1] ^= m_state[2];
+      m_state[0] ^= m_state[3];
+      m_state[2] ^= t;
+      m_state[3] = rotl(m_state[3], 45);
+      return result;
+    }
+
+    void fillBatch() {
+      for (auto& uuid : m_batch) {
+        const std::uint64_t hi = nextRandom();
+        const std::uint64_t lo = nextRandom();
+        for (int i = 0; i < 8; ++i) {
+          uuid.data[i] = static_cast<std::uint8_t>(hi >> (8 * i));
+          uuid.data[8 + i] = static_cast<std::uint8_t>(lo >> (8 * i));
+        }
+        // RFC 4122: version 4, variant 10xx
+        uuid.data[6] = static_cast<std::uint8_t>((uuid.data[6] & 0x0F) | 0x40);
+        uuid.data[8] = static_cast<std::uint8_t>((uuid.data[8] & 0x3F) | 0x80);
+      }
+      m_next = 0;
+    }
+
+    std::array<std::uint64_t, 4> m_state{};
+    std::array<boost::uuids::uuid, batchSize> m_batch{};
+    size_t m_next = batchSize;
+    std::uint64_t m_epoch = 0;
+    bool m_initialized = false;
+  };
+
+}  // namespace
+
 namespace detail {
   struct BoostGeneratorsInitializer : StaticInitializer<BoostGeneratorsInitializer>
   {
@@ -61,13 +159,8 @@ UUID::UUID() : boost::uuids::uuid(boost::uuids::nil_uuid()) {}
 UUID::UUID(const boost::uuids::uuid& t_other) : boost::uuids::uuid(t_other) {}
 
 UUID UUID::random_generate() {
-  static boost::thread_specific_ptr<boost::uuids::random_generator> gen;
-
-  if (gen.get() == nullptr) {
-    gen.reset(new boost::uuids::random_generator);
-  }
-
-  return UUID((*gen)());
+  thread_local FastUUIDGenerator gen;
+  return UUID(gen());
 }
 
 UUID UUID::string_generate(const std::string& t_str) {
@@ -84,6 +177,18 @@ UUID createUUID() {
   return UUID::random_generate();
 }
 
+void setUUIDSeed(std::uint64_t seed) {
+  uuidSeed.store(seed, std::memory_order_relaxed);
+  uuidSeededThreads.store(0, std::memory_order_relaxed);
+  uuidSeeded.store(true, std::memory_order_release);
+  uuidSeedEpoch.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void clearUUIDSeed() {
+  uuidSeeded.store(false, std::memory_order_release);
+  uuidSeedEpoch.fetch_add(1, std::memory_order_acq_rel);
+}
+
 UUID toUUID(const std::string& str) {
   try {
     return UUID::string_generate(str);
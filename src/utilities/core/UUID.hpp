@@ -35,6 +35,7 @@
 
 #include <boost/optional.hpp>
 #include <boost/uuid/uuid.hpp>
+#include <cstdint>
 #include <vector>
 #include <ostream>
 #include <string>
@@ -45,6 +46,13 @@ class UTILITIES_API UUID;
 /// create a UUID
 UTILITIES_API UUID createUUID();
 
+/** Make createUUID deterministic, for reproducible regression runs. Each thread that creates a UUID after this call gets its own sequence
+ *  derived from seed, in the order the threads first call createUUID. */
+UTILITIES_API void setUUIDSeed(std::uint64_t seed);
+
+/// Go back to seeding createUUID from std::random_device, this is the default
+UTILITIES_API void clearUUIDSeed();
+
 /// create a UUID from a std::string, does not throw, may return a null UUID
 UTILITIES_API UUID toUUID(const std::string& str);
 
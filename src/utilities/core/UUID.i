@@ -32,6 +32,11 @@ namespace openstudio{
 
   UUID createUUID();
 
+  // Makes createUUID deterministic, for reproducible regression runs
+  void setUUIDSeed(unsigned long long seed);
+
+  void clearUUIDSeed();
+
   std::string removeBraces(const UUID& uuid);
 
   %extend UUID{
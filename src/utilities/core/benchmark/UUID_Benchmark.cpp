@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+
+#include "../UUID.hpp"
+
+#include <boost/thread/tss.hpp>
+#include <boost/uuid/uuid_generators.hpp>
+
+using namespace openstudio;
+
+// What createUUID used to do: a boost::uuids::random_generator per thread, looked up through thread specific storage on each call
+static boost::uuids::uuid boostRandomGenerate() {
+  static boost::thread_specific_ptr<boost::uuids::random_generator> gen;
+  if (gen.get() == nullptr) {
+    gen.reset(new boost::uuids::random_generator);
+  }
+  return (*gen)();
+}
+
+static void BM_UUIDBoostRandomGenerator(benchmark::State& state) {
+  for (auto _ : state) {
+    boost::uuids::uuid uuid = boostRandomGenerate();
+    benchmark::DoNotOptimize(uuid);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+static void BM_UUIDCreateUUID(benchmark::State& state) {
+  for (auto _ : state) {
+    UUID uuid = createUUID();
+    benchmark::DoNotOptimize(uuid);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+static void BM_UUIDCreateUUIDSeeded(benchmark::State& state) {
+  setUUIDSeed(42);
+  for (auto _ : state) {
+    UUID uuid = createUUID();
+    benchmark::DoNotOptimize(uuid);
+  }
+  clearUUIDSeed();
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_UUIDBoostRandomGenerator)->Threads(1)->Threads(8);
+BENCHMARK(BM_UUIDCreateUUID)->Threads(1)->Threads(8);
+BENCHMARK(BM_UUIDCreateUUIDSeeded);
@@ -340,4 +340,78 @@ TEST(LoggerTest, file_logger_disable) {
 
   EXPECT_NO_THROW(openstudio::filesystem::remove(path));
 }
+
+TEST(LoggerTest, file_logger_asynchronous) {
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  openstudio::path path = toPath("./file_logger_asynchronous.log");
+  openstudio::filesystem::remove(path);
+  ASSERT_FALSE(openstudio::filesystem::exists(path));
+
+  {
+    FileLogSink sink(path, true);
+    EXPECT_TRUE(sink.isAsynchronous());
+    EXPECT_FALSE(sink.autoFlush());
+    sink.setLogLevel(Error);
+    sink.setChannelRegex(boost::regex("hello\\..*"));
+    ASSERT_TRUE(openstudio::filesystem::exists(path));
+
+    for (int i = 0; i < 100; ++i) {
+      freeLogging();
+      classLogging();
+    }
+
+    // logMessages flushes the queue before reading the file back
+    std::vector<LogMessage> logMessages = sink.logMessages();
+    ASSERT_EQ(100u, logMessages.size());
+    EXPECT_EQ(Error, logMessages[0].logLevel());
+    EXPECT_EQ("hello.channel", logMessages[0].logChannel());
+    EXPECT_EQ("Hello Error", logMessages[0].logMessage());
+
+    sink.disable();
+  }
+
+  EXPECT_NO_THROW(openstudio::filesystem::remove(path));
+}
+
+TEST(LoggerTest, disabled_messages_are_not_formatted) {
+  openstudio::Logger::instance().standardOutLogger().disable();
+
+  int formatted = 0;
+  auto message = [&formatted]() {
+    ++formatted;
+    return "formatted";
+  };
+
+  StringStreamLogSink sink;
+  sink.setLogLevel(Warn);
+  EXPECT_FALSE(openstudio::LoggerSingleton::isLevelEnabled(Debug));
+  EXPECT_TRUE(openstudio::LoggerSingleton::isLevelEnabled(Warn));
+
+  LOG_FREE(Debug, "free.channel", message());
+  EXPECT_EQ(0, formatted);
+  LOG_FREE(Warn, "free.channel", message());
+  EXPECT_EQ(1, formatted);
+
+  // the level is enabled but no sink listens to this channel
+  sink.setChannelRegex(boost::regex("hello\\..*"));
+  EXPECT_FALSE(openstudio::LoggerSingleton::isChannelEnabled(Warn, "free.channel"));
+  EXPECT_TRUE(openstudio::LoggerSingleton::isChannelEnabled(Warn, "hello.channel"));
+  LOG_FREE(Warn, "free.channel", message());
+  EXPECT_EQ(1, formatted);
+  LOG_FREE(Warn, "hello.channel", message());
+  EXPECT_EQ(2, formatted);
+
+  // lowering the level of the sink is picked up by the cached thresholds
+  sink.setLogLevel(Debug);
+  LOG_FREE(Debug, "hello.channel", message());
+  EXPECT_EQ(3, formatted);
+
+  ASSERT_EQ(3u, sink.logMessages().size());
+  EXPECT_EQ("formatted", sink.logMessages()[2].logMessage());
+
+  sink.disable();
+  LOG_FREE(Fatal, "free.channel", message());
+  EXPECT_EQ(3, formatted);
+}
 }  // namespace
@@ -34,6 +34,8 @@
 
 #include <iostream>
 #include <set>
+#include <thread>
+#include <vector>
 
 using std::cout;
 using openstudio::UUID;
@@ -91,3 +93,40 @@ TEST(UUID, UUID_UID) {
   EXPECT_EQ(uuid, toUUID(uuidStr));
   EXPECT_EQ(uuid, toUUID(uidStr));  // no extra conversion process
 }
+
+TEST(UUID, Version4) {
+  for (unsigned i = 0; i < 100; ++i) {
+    UUID uuid = createUUID();
+    EXPECT_EQ(boost::uuids::uuid::version_random_number_based, uuid.version());
+    EXPECT_EQ(boost::uuids::uuid::variant_rfc_4122, uuid.variant());
+    EXPECT_TRUE(boost::regex_match(toString(uuid), openstudio::uuidInString()));
+  }
+}
+
+TEST(UUID, Seeded) {
+  auto makeUUIDs = []() {
+    std::vector<UUID> result;
+    for (unsigned i = 0; i < 100; ++i) {
+      result.push_back(createUUID());
+    }
+    return result;
+  };
+
+  openstudio::setUUIDSeed(1234);
+  std::vector<UUID> uuids1 = makeUUIDs();
+  openstudio::setUUIDSeed(1234);
+  std::vector<UUID> uuids2 = makeUUIDs();
+  EXPECT_EQ(uuids1, uuids2);
+  EXPECT_EQ(uuids1.size(), std::set<UUID>(uuids1.begin(), uuids1.end()).size());
+
+  // Another thread gets its own sequence
+  std::vector<UUID> uuidsThread;
+  std::thread([&]() { uuidsThread = makeUUIDs(); }).join();
+  EXPECT_NE(uuids1, uuidsThread);
+
+  openstudio::setUUIDSeed(4321);
+  EXPECT_NE(uuids1, makeUUIDs());
+
+  openstudio::clearUUIDSeed();
+  EXPECT_NE(uuids1, makeUUIDs());
+}
@@ -37,23 +37,156 @@
 #include "../data/Vector.hpp"
 #include "../time/DateTime.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
 #include <iostream>
-
-#include <boost/regex.hpp>
+#include <limits>
 
 namespace openstudio {
 namespace detail {
 
-  CSVFile_Impl::CSVFile_Impl() : m_numColumns(0) {}
+  namespace {
 
-  CSVFile_Impl::CSVFile_Impl(const std::string& s) {
-    std::istringstream ss(s);
+    // Returns true if an unquoted cell is a number. Digits with an optional leading minus sign are an Integer (if they fit in an int),
+    // digits with an optional sign and fraction are a Double. Cells without a leading digit (".5") or with an exponent ("1e5") stay strings
+    bool parseNumber(std::string_view cell, double& value, VariantType::domain& type) {
+      constexpr size_t maxLength = 63;
+      const size_t n = cell.size();
+      if (n == 0 || n > maxLength) {
+        return false;
+      }
 
-    // will throw on error
-    m_rows = parseRows(ss);
+      auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
+
+      size_t i = 0;
+      bool isInteger = true;
+      if (cell[i] == '+' || cell[i] == '-') {
+        isInteger = (cell[i] == '-');
+        ++i;
+      }
+      size_t numDigits = 0;
+      for (; i < n && isDigit(cell[i]); ++i) {
+        ++numDigits;
+      }
+      if (numDigits == 0) {
+        return false;
+      }
+      if (i < n && cell[i] == '.') {
+        isInteger = false;
+        ++i;
+        while (i < n && isDigit(cell[i])) {
+          ++i;
+        }
+      }
+      if (i != n) {
+        return false;
+      }
+
+      // strtod and strtoll need a null terminated string, the cell is a view into the whole file
+      std::array<char, maxLength + 1> buffer;
+      std::copy(cell.begin(), cell.end(), buffer.begin());
+      buffer[n] = '\0';
+
+      if (isInteger) {
+        errno = 0;
+        const long long integer = std::strtoll(buffer.data(), nullptr, 10);
+        if (errno == 0 && integer >= std::numeric_limits<int>::min() && integer <= std::numeric_limits<int>::max()) {
+          value = static_cast<double>(integer);
+          type = VariantType::Integer;
+          return true;
+        }
+      }
+      value = std::strtod(buffer.data(), nullptr);
+      type = VariantType::Double;
+      return true;
+    }
+
+    // Writes a string cell, quoting it (and doubling embedded quotes) when it would not read back as a single cell
+    void writeStringCell(std::ostream& os, const std::string& s) {
+      if (s.find_first_of(",\"\r\n") == std::string::npos) {
+        os << s;
+        return;
+      }
+      os << '"';
+      for (const char c : s) {
+        if (c == '"') {
+          os << '"';
+        }
+        os << c;
+      }
+      os << '"';
+    }
 
-    assignNumColumns();
-    padRows();
+  }  // namespace
+
+  void CSVFile_Impl::Column::reserve(size_t n) {
+    types.reserve(n);
+    numbers.reserve(n);
+    strings.reserve(n);
+  }
+
+  void CSVFile_Impl::Column::pushNumber(double value, VariantType::domain type) {
+    types.push_back(type);
+    numbers.push_back(value);
+    strings.emplace_back();
+    if (type == VariantType::Boolean) {
+      ++numNonNumeric;
+    }
+  }
+
+  void CSVFile_Impl::Column::pushString(std::string value) {
+    types.push_back(VariantType::String);
+    numbers.push_back(0.0);
+    strings.push_back(std::move(value));
+    ++numNonNumeric;
+  }
+
+  void CSVFile_Impl::Column::push(const Variant& value) {
+    switch (value.variantType().value()) {
+      case VariantType::Boolean:
+        pushNumber(value.valueAsBoolean() ? 1.0 : 0.0, VariantType::Boolean);
+        break;
+      case VariantType::Integer:
+        pushNumber(value.valueAsInteger(), VariantType::Integer);
+        break;
+      case VariantType::Double:
+        pushNumber(value.valueAsDouble(), VariantType::Double);
+        break;
+      default:
+        pushString(value.valueAsString());
+        break;
+    }
+  }
+
+  void CSVFile_Impl::Column::padTo(size_t n) {
+    if (types.size() < n) {
+      numNonNumeric += n - types.size();
+      types.resize(n, VariantType::String);
+      numbers.resize(n, 0.0);
+      strings.resize(n);
+    }
+  }
+
+  Variant CSVFile_Impl::Column::variant(size_t i) const {
+    switch (types[i]) {
+      case VariantType::Boolean:
+        return Variant(numbers[i] != 0.0);
+      case VariantType::Integer:
+        return Variant(static_cast<int>(numbers[i]));
+      case VariantType::Double:
+        return Variant(numbers[i]);
+      default:
+        return Variant(strings[i]);
+    }
+  }
+
+  CSVFile_Impl::CSVFile_Impl() = default;
+
+  CSVFile_Impl::CSVFile_Impl(const std::string& s) {
+    // will throw on error
+    parse(s);
   }
 
   CSVFile_Impl::CSVFile_Impl(const openstudio::path& p) {
@@ -63,13 +196,13 @@ namespace detail {
 
     // open file
     std::ifstream ifs(openstudio::toSystemFilename(p));
+    std::stringstream ss;
+    ss << ifs.rdbuf();
 
     // will throw on error
-    m_rows = parseRows(ifs);
+    parse(ss.str());
 
     m_path = p;
-    assignNumColumns();
-    padRows();
   }
 
   CSVFile CSVFile_Impl::clone() const {
@@ -82,34 +215,29 @@ namespace detail {
   }
 
   std::string CSVFile_Impl::string() const {
-    static const boost::regex escapeItRegex(",");
+    const size_t numColumns = m_columns.size();
 
-    std::string s;
     std::stringstream result;
-    for (const auto& row : m_rows) {
-      OS_ASSERT(row.size() == m_numColumns);
-      for (size_t i = 0; i < m_numColumns; ++i) {
+    for (unsigned r = 0; r < m_numRows; ++r) {
+      for (size_t i = 0; i < numColumns; ++i) {
+        const Column& column = m_columns[i];
+        OS_ASSERT(column.types.size() == m_numRows);
 
-        switch (row[i].variantType().value()) {
+        switch (column.types[r]) {
           case VariantType::Integer:
-            result << row[i].valueAsInteger();
+            result << static_cast<int>(column.numbers[r]);
             break;
           case VariantType::Double:
-            result << row[i].valueAsDouble();
+            result << column.numbers[r];
             break;
           case VariantType::String:
-            s = row[i].valueAsString();
-            if (boost::regex_match(s, escapeItRegex)) {
-              result << "\"" << s << "\"";
-            } else {
-              result << s;
-            }
+            writeStringCell(result, column.strings[r]);
             break;
           default:
             break;
         }
 
-        if (i < m_numColumns - 1) {
+        if (i < numColumns - 1) {
           result << ",";
         }
       }
@@ -164,124 +292,126 @@ namespace detail {
   }
 
   unsigned CSVFile_Impl::numColumns() const {
-    return m_numColumns;
+    return m_columns.size();
   }
 
   unsigned CSVFile_Impl::numRows() const {
-    return m_rows.size();
+    return m_numRows;
   }
 
   std::vector<std::vector<Variant>> CSVFile_Impl::rows() const {
-    return m_rows;
+    std::vector<std::vector<Variant>> result(m_numRows);
+    for (unsigned r = 0; r < m_numRows; ++r) {
+      result[r].reserve(m_columns.size());
+      for (const auto& column : m_columns) {
+        result[r].push_back(column.variant(r));
+      }
+    }
+    return result;
   }
 
   void CSVFile_Impl::addRow(const std::vector<Variant>& row) {
-    m_rows.push_back(row);
-    if (row.size() > m_numColumns) {
-      m_numColumns = row.size();
-      padRows();
+    while (m_columns.size() < row.size()) {
+      appendColumn();
     }
 
-    while (m_rows[m_rows.size() - 1].size() < m_numColumns) {
-      m_rows[m_rows.size() - 1].push_back(Variant(""));
+    for (size_t i = 0; i < m_columns.size(); ++i) {
+      if (i < row.size()) {
+        m_columns[i].push(row[i]);
+      } else {
+        m_columns[i].pushString("");
+      }
     }
+    ++m_numRows;
   }
 
   void CSVFile_Impl::setRows(const std::vector<std::vector<Variant>>& rows) {
-    m_rows = rows;
-    assignNumColumns();
+    m_columns.clear();
+    m_numRows = 0;
+    for (const auto& row : rows) {
+      addRow(row);
+    }
   }
 
   void CSVFile_Impl::clear() {
-    m_rows.clear();
+    m_columns.clear();
     m_path.reset();
-    m_numColumns = 0;
+    m_numRows = 0;
   }
 
   unsigned CSVFile_Impl::addColumn(const std::vector<DateTime>& dateTimes) {
-    unsigned n = dateTimes.size();
-    ensureNumRows(n);
+    ensureNumRows(dateTimes.size());
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(dateTimes[i].toISO8601()));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
+    Column column;
+    column.reserve(m_numRows);
+    for (const auto& dateTime : dateTimes) {
+      column.pushString(dateTime.toISO8601());
     }
+    column.padTo(m_numRows);
+    m_columns.push_back(std::move(column));
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
   unsigned CSVFile_Impl::addColumn(const Vector& values) {
-    unsigned n = values.size();
-    ensureNumRows(n);
+    ensureNumRows(values.size());
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
+    Column column;
+    column.reserve(m_numRows);
+    for (unsigned i = 0; i < values.size(); ++i) {
+      column.pushNumber(values[i], VariantType::Double);
     }
+    column.padTo(m_numRows);
+    m_columns.push_back(std::move(column));
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
   unsigned CSVFile_Impl::addColumn(const std::vector<double>& values) {
-    unsigned n = values.size();
-    ensureNumRows(n);
+    ensureNumRows(values.size());
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
+    Column column;
+    column.reserve(m_numRows);
+    for (const double value : values) {
+      column.pushNumber(value, VariantType::Double);
     }
+    column.padTo(m_numRows);
+    m_columns.push_back(std::move(column));
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
   unsigned CSVFile_Impl::addColumn(const std::vector<std::string>& values) {
-    unsigned n = values.size();
-    ensureNumRows(n);
+    ensureNumRows(values.size());
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
+    Column column;
+    column.reserve(m_numRows);
+    for (const auto& value : values) {
+      column.pushString(value);
     }
+    column.padTo(m_numRows);
+    m_columns.push_back(std::move(column));
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
   std::vector<DateTime> CSVFile_Impl::getColumnAsDateTimes(unsigned columnIndex) const {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return {};
     }
 
-    std::vector<DateTime> result;
+    const Column& column = m_columns[columnIndex];
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (m_rows[i][columnIndex].variantType() != VariantType::String) {
+    std::vector<DateTime> result;
+    result.reserve(m_numRows);
+    for (unsigned i = 0; i < m_numRows; ++i) {
+      if (column.types[i] != VariantType::String) {
         LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a DateTime string");
         return {};
       }
 
-      boost::optional<DateTime> dateTime = DateTime::fromISO8601(m_rows[i][columnIndex].valueAsString());
+      boost::optional<DateTime> dateTime = DateTime::fromISO8601(column.strings[i]);
       if (!dateTime) {
         LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a DateTime string");
         return {};
@@ -293,54 +423,42 @@ namespace detail {
   }
 
   std::vector<double> CSVFile_Impl::getColumnAsDoubleVector(unsigned columnIndex) const {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return {};
     }
 
-    std::vector<double> result;
-
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-
-      boost::optional<double> value;
-      if (m_rows[i][columnIndex].variantType() == VariantType::Double) {
-        value = m_rows[i][columnIndex].valueAsDouble();
-      } else if (m_rows[i][columnIndex].variantType() == VariantType::Integer) {
-        value = m_rows[i][columnIndex].valueAsInteger();
-      }
-
-      if (!value) {
-        LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a numeric value");
-        return {};
-      }
-      result.push_back(*value);
+    const Column& column = m_columns[columnIndex];
+    if (column.numNonNumeric > 0) {
+      auto it = std::find_if(column.types.begin(), column.types.end(),
+                             [](VariantType::domain type) { return type != VariantType::Integer && type != VariantType::Double; });
+      LOG(Warn, "Value at row " << std::distance(column.types.begin(), it) << " and column " << columnIndex << " is not a numeric value");
+      return {};
     }
 
-    return result;
+    return column.numbers;
   }
 
   std::vector<std::string> CSVFile_Impl::getColumnAsStringVector(unsigned columnIndex) const {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return {};
     }
 
-    std::vector<std::string> result;
+    const Column& column = m_columns[columnIndex];
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
+    std::vector<std::string> result;
+    result.reserve(m_numRows);
+    for (unsigned i = 0; i < m_numRows; ++i) {
 
-      if (m_rows[i][columnIndex].variantType() == VariantType::String) {
-        result.push_back(m_rows[i][columnIndex].valueAsString());
-      } else if (m_rows[i][columnIndex].variantType() == VariantType::Double) {
-        std::stringstream ss;
-        ss << m_rows[i][columnIndex].valueAsDouble();
-        result.push_back(ss.str());
-      } else if (m_rows[i][columnIndex].variantType() == VariantType::Integer) {
+      if (column.types[i] == VariantType::String) {
+        result.push_back(column.strings[i]);
+      } else if (column.types[i] == VariantType::Double) {
         std::stringstream ss;
-        ss << m_rows[i][columnIndex].valueAsInteger();
+        ss << column.numbers[i];
         result.push_back(ss.str());
+      } else if (column.types[i] == VariantType::Integer) {
+        result.push_back(std::to_string(static_cast<int>(column.numbers[i])));
       }
     }
 
@@ -348,69 +466,104 @@ namespace detail {
   }
 
   // throws on error
-  std::vector<std::vector<Variant>> CSVFile_Impl::parseRows(std::istream& input) {
-    std::vector<std::vector<Variant>> result;
+  void CSVFile_Impl::parse(std::string_view text) {
+    m_columns.clear();
+    m_numRows = 0;
 
     // DLM: what conditions should make this throw?
 
-    // Excel formated CSV regex, \A[^,"]*(?=,)|(?:[^",]*"[^"]*"[^",]*)+|[^",]*"[^"]*\Z|(?<=,)[^,]*(?=,)|(?<=,)[^,]*\Z|\A[^,]*\Z
-    static const boost::regex csvRegex(
-      "\\A[^,\"]*(?=,)|(?:[^\",]*\"[^\"]*\"[^\",]*)+|[^\",]*\"[^\"]*\\Z|(?<=,)[^,]*(?=,)|(?<=,)[^,]*\\Z|\\A[^,]*\\Z");
-    static const boost::regex intRegex("^[-0-9]+$");
-    static const boost::regex doubleRegex("^[+-]?\\d+\\.?(\\d+)?$");
-    static const boost::regex quoteRegex("^\"(.*)\"$");
-
-    std::string line;
-    while (std::getline(input, line)) {
-      std::vector<Variant> row;
-      boost::regex_token_iterator<std::string::iterator> it{line.begin(), line.end(), csvRegex, 0};
-      boost::regex_token_iterator<std::string::iterator> end;
-      while (it != end) {
-        std::string value = *it;
-        if (boost::regex_match(value, intRegex)) {
-          row.push_back(Variant(std::stoi(value)));
-        } else if (boost::regex_match(value, doubleRegex)) {
-          row.push_back(Variant(std::stod(value)));
-        } else {
-          boost::smatch valueMatch;
-          if (boost::regex_search(value, valueMatch, quoteRegex)) {
-            row.push_back(Variant(valueMatch[1]));
-          } else {
-            row.push_back(Variant(value));
+    // RFC 4180: cells are separated by commas and rows by line breaks (CRLF or LF), a quoted cell may contain commas, line breaks and
+    // doubled quotes. Quoted cells are always strings, unquoted cells that look like numbers are stored as numbers.
+    const size_t n = text.size();
+    const size_t expectedNumRows = std::count(text.begin(), text.end(), '\n') + 1;
+
+    auto cellEnd = [&text, n](size_t pos) {
+      const size_t end = text.find_first_of(",\n", pos);
+      return (end == std::string_view::npos) ? n : end;
+    };
+
+    // strips the CR of a CRLF line break
+    auto trimLineEnd = [&text, n](std::string_view cell, size_t end) {
+      if ((end == n || text[end] == '\n') && !cell.empty() && cell.back() == '\r') {
+        cell.remove_suffix(1);
+      }
+      return cell;
+    };
+
+    std::string quoted;
+    size_t pos = 0;
+    size_t columnIndex = 0;
+    bool cellPending = (n > 0);
+    while (cellPending) {
+      if (columnIndex == m_columns.size()) {
+        appendColumn().reserve(expectedNumRows);
+      }
+      Column& column = m_columns[columnIndex];
+
+      if (pos < n && text[pos] == '"') {
+        quoted.clear();
+        for (++pos; pos < n; ++pos) {
+          if (text[pos] == '"') {
+            if (pos + 1 < n && text[pos + 1] == '"') {
+              ++pos;
+            } else {
+              ++pos;
+              break;
+            }
           }
+          quoted.push_back(text[pos]);
+        }
+        // anything between the closing quote and the next delimiter is kept as is
+        const size_t end = cellEnd(pos);
+        quoted.append(trimLineEnd(text.substr(pos, end - pos), end));
+        column.pushString(quoted);
+        pos = end;
+      } else {
+        const size_t end = cellEnd(pos);
+        const std::string_view cell = trimLineEnd(text.substr(pos, end - pos), end);
+        double value = 0.0;
+        VariantType::domain type = VariantType::String;
+        if (parseNumber(cell, value, type)) {
+          column.pushNumber(value, type);
+        } else {
+          column.pushString(std::string(cell));
         }
-        ++it;
+        pos = end;
       }
-      result.push_back(row);
-    }
 
-    return result;
-  }
+      if (pos < n && text[pos] == ',') {
+        // a trailing comma at the end of the text still starts an (empty) cell
+        ++pos;
+        ++columnIndex;
+        continue;
+      }
 
-  void CSVFile_Impl::assignNumColumns() {
-    m_numColumns = 0;
-    for (const auto& row : m_rows) {
-      m_numColumns = std::max<unsigned>(m_numColumns, row.size());
+      // end of row, pad the columns this row did not reach
+      ++m_numRows;
+      for (size_t i = columnIndex + 1; i < m_columns.size(); ++i) {
+        m_columns[i].padTo(m_numRows);
+      }
+      columnIndex = 0;
+
+      // skip the line break, text ending with a line break does not have an extra empty row
+      ++pos;
+      cellPending = (pos < n);
     }
   }
 
-  void CSVFile_Impl::ensureNumRows(unsigned numRows) {
-    // add empty cells to existing columns if needed
-    if (numRows > m_rows.size()) {
-      unsigned numRowsToAdd = numRows - m_rows.size();
-      std::vector<Variant> blankRow(m_numColumns, Variant(""));
-      for (unsigned i = 0; i < numRowsToAdd; ++i) {
-        m_rows.push_back(blankRow);
-      }
-    }
-    OS_ASSERT(m_rows.size() >= numRows);
+  CSVFile_Impl::Column& CSVFile_Impl::appendColumn() {
+    Column& column = m_columns.emplace_back();
+    column.padTo(m_numRows);
+    return column;
   }
 
-  void CSVFile_Impl::padRows() {
-    for (auto& row : m_rows) {
-      while (row.size() < m_numColumns) {
-        row.push_back(Variant(""));
+  void CSVFile_Impl::ensureNumRows(unsigned numRows) {
+    // add empty cells to existing columns if needed
+    if (numRows > m_numRows) {
+      for (auto& column : m_columns) {
+        column.padTo(numRows);
       }
+      m_numRows = numRows;
     }
   }
 
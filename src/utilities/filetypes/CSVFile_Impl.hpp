@@ -34,12 +34,14 @@
 
 #include "../core/Logger.hpp"
 #include "../core/Path.hpp"
+#include "../data/Variant.hpp"
 #include "../data/Vector.hpp"
 
+#include <string_view>
+
 namespace openstudio {
 
 class CSVFile;
-class Variant;
 class DateTime;
 
 namespace detail {
@@ -104,18 +106,38 @@ namespace detail {
    private:
     REGISTER_LOGGER("openstudio.CSVFile");
 
-    // throws on error
-    static std::vector<std::vector<Variant>> parseRows(std::istream& input);
-
-    void assignNumColumns();
+    /** Cells of one column stored by type, numeric cells are never boxed into a Variant so that a numeric column can be
+     *  returned as a straight copy of numbers. */
+    struct Column
+    {
+      // type of each cell
+      std::vector<VariantType::domain> types;
+      // value of Integer, Double and Boolean cells, 0 for String cells
+      std::vector<double> numbers;
+      // value of String cells, empty for other cells
+      std::vector<std::string> strings;
+      // number of cells that are neither Integer nor Double
+      unsigned numNonNumeric = 0;
+
+      void reserve(size_t n);
+      void pushNumber(double value, VariantType::domain type);
+      void pushString(std::string value);
+      void push(const Variant& value);
+      void padTo(size_t n);
+      Variant variant(size_t i) const;
+    };
+
+    // fills m_columns and m_numRows from CSV text, throws on error
+    void parse(std::string_view text);
+
+    // adds a column padded with empty cells up to the current number of rows
+    Column& appendColumn();
 
     void ensureNumRows(unsigned numRows);
 
-    void padRows();
-
     boost::optional<openstudio::path> m_path;
-    unsigned m_numColumns;
-    std::vector<std::vector<Variant>> m_rows;
+    unsigned m_numRows = 0;
+    std::vector<Column> m_columns;
   };
 
 }  // namespace detail
@@ -37,6 +37,7 @@
 
 #include <fmt/format.h>
 #include <cmath>
+#include <limits>
 
 namespace openstudio {
 
@@ -222,8 +223,12 @@ AirState::AirState() {
   m_wetbulb = wetbulb.get();
 }
 
+AirState::AirState(double drybulb, double pressure)
+  : m_drybulb(drybulb), m_dewpoint(0.0), m_pressure(pressure), m_wetbulb(0.0), m_psat(0.0), m_W(0.0), m_h(0.0), m_phi(0.0), m_v(0.0) {}
+
 boost::optional<AirState> AirState::fromDryBulbDewPointPressure(double drybulb, double dewpoint, double pressure) {
-  AirState state;
+  // Don't use the default constructor, it solves for the dew point and wet bulb of the default state
+  AirState state(drybulb, pressure);
   if (drybulb < -100.0 || drybulb > 200.0) {
     // Out of the range of our current psat function
     return boost::none;
@@ -253,7 +258,7 @@ boost::optional<AirState> AirState::fromDryBulbDewPointPressure(double drybulb,
 }
 
 boost::optional<AirState> AirState::fromDryBulbRelativeHumidityPressure(double drybulb, double RH, double pressure) {
-  AirState state;
+  AirState state(drybulb, pressure);
   if (drybulb < -100.0 || drybulb > 200.0) {
     // Out of the range of our current psat function
     return boost::none;
@@ -330,6 +335,99 @@ double AirState::R() {
   return 8314.472 / 28.966;  // eqn 1 from ASHRAE Fundamentals 2009 Ch. 1
 }
 
+AirStateSeries::AirStateSeries(const std::vector<double>& drybulb, const std::vector<double>& dewpoint, const std::vector<double>& relativeHumidity,
+                               const std::vector<double>& pressure) {
+  const size_t n = drybulb.size();
+  if (dewpoint.size() != n || relativeHumidity.size() != n || pressure.size() != n) {
+    LOG_FREE_AND_THROW("openstudio.AirStateSeries", "Dry bulb, dew point, relative humidity and pressure series must have the same length");
+  }
+  constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+  // Same range checks as the AirState statics, written so that NaN inputs fail them
+  auto inPsatRange = [](double T) { return T >= -100.0 && T <= 200.0; };
+
+  // Water vapor saturation pressure, eqns 5 and 6 (only needs the dry bulb)
+  m_psat.resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    m_psat[i] = inPsatRange(drybulb[i]) ? psat(drybulb[i]) : nan;
+  }
+
+  // Humidity ratio, enthalpy, specific volume and density, eqns 22, 24, 28, 32 and 38
+  m_W.resize(n);
+  m_h.resize(n);
+  m_v.resize(n);
+  m_density.resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    double pw = nan;
+    if (!inPsatRange(drybulb[i])) {
+      // No state without a dry bulb
+    } else if (!std::isnan(relativeHumidity[i])) {
+      if (relativeHumidity[i] >= 0.0 && relativeHumidity[i] <= 100.0) {
+        pw = (0.01 * relativeHumidity[i]) * m_psat[i];  // Relative humidity, eqn 24
+        // AirState has no state when the dew point solve fails, so neither does the series
+        if (!solveForDewPoint(drybulb[i], pw, 1e-4, 100)) {
+          pw = nan;
+        }
+      }
+    } else if (inPsatRange(dewpoint[i])) {
+      pw = psat(dewpoint[i]);  // Partial pressure of water vapor, eqn 38
+    }
+    const double T = drybulb[i];
+    const double p = pressure[i];
+    // NaN propagates from a missing dry bulb, humidity or pressure
+    const double W = 0.621945 * pw / (p - pw);
+    m_W[i] = W;
+    m_h[i] = 1.006 * T + W * (2501 + 1.86 * T);
+    m_v[i] = 0.287042 * (T + 273.15) * (1 + 1.607858 * W) / p;
+    m_density[i] = 1.0 / m_v[i];
+  }
+
+  // Wet bulb temperature, iterative so done per state; a state without a wet bulb has no properties, as with AirState
+  m_wetbulb.resize(n);
+  for (size_t i = 0; i < n; ++i) {
+    boost::optional<double> wetbulb;
+    if (!std::isnan(m_W[i])) {
+      wetbulb = solveForWetBulb(drybulb[i], pressure[i], m_W[i], 1e-4, 100);
+    }
+    if (wetbulb) {
+      m_wetbulb[i] = wetbulb.get();
+    } else {
+      m_wetbulb[i] = nan;
+      m_W[i] = nan;
+      m_h[i] = nan;
+      m_v[i] = nan;
+      m_density[i] = nan;
+    }
+  }
+}
+
+size_t AirStateSeries::size() const {
+  return m_psat.size();
+}
+
+const std::vector<double>& AirStateSeries::wetbulb() const {
+  return m_wetbulb;
+}
+
+const std::vector<double>& AirStateSeries::enthalpy() const {
+  return m_h;
+}
+
+const std::vector<double>& AirStateSeries::saturationPressure() const {
+  return m_psat;
+}
+
+const std::vector<double>& AirStateSeries::density() const {
+  return m_density;
+}
+
+const std::vector<double>& AirStateSeries::specificVolume() const {
+  return m_v;
+}
+
+const std::vector<double>& AirStateSeries::humidityRatio() const {
+  return m_W;
+}
+
 EpwDataPoint::EpwDataPoint()
   : m_year(1),
     m_month(1),
@@ -1580,6 +1678,29 @@ static int stringToInteger(const std::string& string, bool* ok) {
   return value;
 }
 
+// Same result as splitString(line, ','), but the strings in fields are reused from one line to the next
+static void splitEpwLine(const std::string& line, std::vector<std::string>& fields) {
+  if (line.empty()) {
+    fields.clear();
+    return;
+  }
+  size_t count = 0;
+  size_t begin = 0;
+  while (true) {
+    size_t end = line.find(',', begin);
+    if (count == fields.size()) {
+      fields.emplace_back();
+    }
+    if (end == std::string::npos) {
+      fields[count++].assign(line, begin, std::string::npos);
+      break;
+    }
+    fields[count++].assign(line, begin, end - begin);
+    begin = end + 1;
+  }
+  fields.resize(count);
+}
+
 static double stringToDouble(const std::string& string, bool* ok) {
   double value = 0;
   *ok = true;
@@ -1593,6 +1714,124 @@ static double stringToDouble(const std::string& string, bool* ok) {
   return value;
 }
 
+// Value of a weather field as EpwDataPoint::getField would report it once the text was set on a data point, without building the data point
+static boost::optional<double> epwDataValue(int field, const std::string& text) {
+  bool ok;
+  if (field == EpwDataField::TotalSkyCover || field == EpwDataField::OpaqueSkyCover) {
+    int value = stringToInteger(text, &ok);
+    if (!ok || 0 > value || 10 < value) {
+      return 99.0;
+    }
+    return static_cast<double>(value);
+  } else if (field == EpwDataField::PresentWeatherObservation || field == EpwDataField::PresentWeatherCodes) {
+    int value = stringToInteger(text, &ok);
+    return ok ? static_cast<double>(value) : 0.0;
+  }
+  double value = stringToDouble(text, &ok);
+  if (!ok) {
+    return boost::none;
+  }
+  auto warn = [value](const char* name) {
+    LOG_FREE(Warn, "openstudio.EpwFile", name << " value '" << value << "' not within the expected limits");
+  };
+  // The text stored for a missing value, which is reported as missing whatever the other checks say
+  const char* missing = nullptr;
+  bool invalid = false;
+  switch (field) {
+    case EpwDataField::DryBulbTemperature:
+      missing = "99.9";
+      if (-70 >= value || 70 <= value) {
+        warn("DryBulbTemperature");
+      }
+      break;
+    case EpwDataField::DewPointTemperature:
+      missing = "99.9";
+      if (-70 >= value || 70 <= value) {
+        warn("DewPointTemperature");
+      }
+      break;
+    case EpwDataField::RelativeHumidity:
+      missing = "999";
+      invalid = 0 > value;
+      if (110 < value) {
+        warn("RelativeHumidity");
+      }
+      break;
+    case EpwDataField::AtmosphericStationPressure:
+      missing = "999999";
+      if (31000 >= value || 120000 <= value) {
+        warn("AtmosphericStationPressure");
+      }
+      break;
+    case EpwDataField::ExtraterrestrialHorizontalRadiation:
+    case EpwDataField::ExtraterrestrialDirectNormalRadiation:
+    case EpwDataField::HorizontalInfraredRadiationIntensity:
+    case EpwDataField::DirectNormalRadiation:
+    case EpwDataField::DiffuseHorizontalRadiation:
+      missing = "9999";
+      invalid = 0 > value || value == 9999;
+      break;
+    case EpwDataField::GlobalHorizontalRadiation:
+      // Stored through the double setter, so the value is rounded like std::to_string does
+      if (0 > value || value == 9999) {
+        return boost::none;
+      }
+      return std::stod(std::to_string(value));
+    case EpwDataField::GlobalHorizontalIlluminance:
+    case EpwDataField::DirectNormalIlluminance:
+    case EpwDataField::DiffuseHorizontalIlluminance:
+      missing = "999999";
+      invalid = 0 > value || 999900 < value;
+      break;
+    case EpwDataField::ZenithLuminance:
+      missing = "9999";
+      invalid = 0 > value || 9999 <= value;
+      break;
+    case EpwDataField::WindDirection:
+      missing = "999";
+      invalid = 0 > value || 360 < value;
+      break;
+    case EpwDataField::WindSpeed:
+      // Stored through the double setter, like the global horizontal radiation
+      if (0 > value) {
+        return boost::none;
+      } else if (40 < value) {
+        warn("WindSpeed");
+      }
+      return std::stod(std::to_string(value));
+    case EpwDataField::Visibility:
+      missing = "9999";
+      invalid = value == 9999;
+      break;
+    case EpwDataField::CeilingHeight:
+      missing = "99999";
+      invalid = value == 99999;
+      break;
+    case EpwDataField::PrecipitableWater:
+    case EpwDataField::SnowDepth:
+    case EpwDataField::Albedo:
+    case EpwDataField::LiquidPrecipitationDepth:
+      missing = "999";
+      invalid = value == 999;
+      break;
+    case EpwDataField::AerosolOpticalDepth:
+      missing = ".999";
+      invalid = value == 0.999;
+      break;
+    case EpwDataField::DaysSinceLastSnowfall:
+    case EpwDataField::LiquidPrecipitationQuantity:
+      missing = "99";
+      invalid = value == 99;
+      break;
+    default:
+      return boost::none;
+  }
+  if (invalid || text == missing) {
+    return boost::none;
+  }
+  return value;
+}
+
 Date EpwDataPoint::date() const {
   return {MonthOfYear(m_month), static_cast<unsigned int>(m_day), m_year};
 }
@@ -2659,22 +2898,22 @@ boost::optional<int> EpwFile::endDateActualYear() const {
 }
 
 std::vector<EpwDataPoint> EpwFile::data() {
+  if (!loadData()) {
+    return m_data;
+  }
+  // The data points are only built on request, the rest of the class works on the columns
   if (m_data.empty()) {
-    if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
-      LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
-    }
-
-    // set checksum
-    m_checksum = openstudio::checksum(m_path);
-
-    // open file
-    std::ifstream ifs(openstudio::toSystemFilename(m_path));
-
-    if (!parse(ifs, true)) {
-      ifs.close();
-      LOG(Error, "EpwFile '" << toString(m_path) << "' cannot be processed");
-    } else {
-      ifs.close();
+    m_data.reserve(m_records.size());
+    std::vector<std::string> strings;
+    for (size_t i = 0; i < m_records.size(); ++i) {
+      splitEpwLine(m_records[i], strings);
+      // The line was checked when it was read, and the minutes are the computed ones
+      boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwStrings(
+        static_cast<int>(m_dataColumns[EpwDataField::Year][i]), static_cast<int>(m_dataColumns[EpwDataField::Month][i]),
+        static_cast<int>(m_dataColumns[EpwDataField::Day][i]), static_cast<int>(m_dataColumns[EpwDataField::Hour][i]),
+        static_cast<int>(m_dataColumns[EpwDataField::Minute][i]), strings);
+      OS_ASSERT(pt);
+      m_data.push_back(std::move(pt.get()));
     }
   }
   return m_data;
@@ -3655,23 +3894,8 @@ std::vector<EpwDesignCondition> EpwFile::designConditions() {
 }
 
 boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
-  if (m_data.empty()) {
-    if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
-      LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
-    }
-
-    // set checksum
-    m_checksum = openstudio::checksum(m_path);
-
-    // open file
-    std::ifstream ifs(openstudio::toSystemFilename(m_path));
-
-    if (!parse(ifs, true)) {
-      ifs.close();
-      LOG(Error, "EpwFile '" << toString(m_path) << "' cannot be processed");
-      return boost::none;
-    }
-    ifs.close();
+  if (!loadData()) {
+    return boost::none;
   }
   EpwDataField id;
   try {
@@ -3680,52 +3904,100 @@ boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
     LOG(Warn, "Unrecognized EPW data field '" << name << "'");
     return boost::none;
   }
-  if (!m_data.empty()) {
-    std::string units = EpwDataPoint::getUnits(id);
-    DateTimeVector dates;
-    dates.push_back(DateTime());  // Use a placeholder to avoid an insert
-    std::vector<double> values;
-    for (unsigned int i = 0; i < m_data.size(); i++) {
-      DateTime dateTime = m_data[i].dateTime();
-      // Time time=m_data[i].time();
-      boost::optional<double> value = m_data[i].getField(id);
-      if (value) {
-        if (isActual()) {
-          dates.push_back(DateTime(dateTime));
-        } else {
-          // Strip year
-          dates.push_back(DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth()), dateTime.time()));
-        }
-        values.push_back(value.get());
-      }
-    }
-    if (!values.empty()) {
-      DateTime start = dates[1] - Time(0, 0, 0, 3600 / m_recordsPerHour);
-      dates[0] = start;  // Overwrite the placeholder
-      return boost::optional<TimeSeries>(TimeSeries(dates, openstudio::createVector(values), units));
+  // The date, time and flag fields are not weather data
+  if (id.value() < EpwDataField::DryBulbTemperature || m_records.empty()) {
+    return boost::none;
+  }
+  const std::vector<double>& column = m_dataColumns[id.value()];
+  const std::vector<bool>& missing = m_missingData[id.value()];
+  const DateTimeVector& recordDates = recordDateTimes(!isActual());
+  DateTimeVector dates;
+  dates.reserve(column.size() + 1);
+  dates.push_back(DateTime());  // Use a placeholder to avoid an insert
+  std::vector<double> values;
+  values.reserve(column.size());
+  for (size_t i = 0; i < column.size(); ++i) {
+    if (!missing[i]) {
+      dates.push_back(recordDates[i]);
+      values.push_back(column[i]);
     }
   }
+  if (!values.empty()) {
+    DateTime start = dates[1] - Time(0, 0, 0, 3600 / m_recordsPerHour);
+    dates[0] = start;  // Overwrite the placeholder
+    return boost::optional<TimeSeries>(TimeSeries(dates, openstudio::createVector(values), EpwDataPoint::getUnits(id)));
+  }
   return boost::none;
 }
 
-boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& name) {
-  if (m_data.empty()) {
-    if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
-      LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
-    }
+const std::vector<double>& EpwFile::dataColumn(EpwDataField field) {
+  loadData();
+  if (m_dataColumns.empty()) {
+    static const std::vector<double> empty;
+    return empty;
+  }
+  return m_dataColumns[field.value()];
+}
 
-    // set checksum
-    m_checksum = openstudio::checksum(m_path);
+const std::vector<bool>& EpwFile::missingDataMask(EpwDataField field) {
+  loadData();
+  if (m_missingData.empty()) {
+    static const std::vector<bool> empty;
+    return empty;
+  }
+  return m_missingData[field.value()];
+}
 
-    // open file
-    std::ifstream ifs(openstudio::toSystemFilename(m_path));
+bool EpwFile::loadData() {
+  if (!m_records.empty()) {
+    return true;
+  }
+  if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
+    LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
+  }
 
-    if (!parse(ifs, true)) {
-      ifs.close();
-      LOG(Error, "EpwFile '" << toString(m_path) << "' cannot be processed");
-      return boost::none;
-    }
+  // set checksum
+  m_checksum = openstudio::checksum(m_path);
+
+  // open file
+  std::ifstream ifs(openstudio::toSystemFilename(m_path));
+
+  if (!parse(ifs, true)) {
     ifs.close();
+    LOG(Error, "EpwFile '" << toString(m_path) << "' cannot be processed");
+    return false;
+  }
+  ifs.close();
+  return true;
+}
+
+const DateTimeVector& EpwFile::recordDateTimes(bool stripYear) {
+  DateTimeVector& result = stripYear ? m_typicalRecordDateTimes : m_recordDateTimes;
+  if (result.size() != m_records.size()) {
+    const std::vector<double>& years = m_dataColumns[EpwDataField::Year];
+    const std::vector<double>& months = m_dataColumns[EpwDataField::Month];
+    const std::vector<double>& days = m_dataColumns[EpwDataField::Day];
+    const std::vector<double>& hours = m_dataColumns[EpwDataField::Hour];
+    const std::vector<double>& minutes = m_dataColumns[EpwDataField::Minute];
+    result.clear();
+    result.reserve(m_records.size());
+    for (size_t i = 0; i < m_records.size(); ++i) {
+      DateTime dateTime(Date(MonthOfYear(static_cast<int>(months[i])), static_cast<unsigned>(days[i]), static_cast<int>(years[i])),
+                        Time(0, static_cast<int>(hours[i]), static_cast<int>(minutes[i])));
+      if (stripYear) {
+        // Hour 24 rolls over into the next day (and year) first, the year is only dropped afterwards
+        result.emplace_back(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth()), dateTime.time());
+      } else {
+        result.push_back(dateTime);
+      }
+    }
+  }
+  return result;
+}
+
+boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& name) {
+  if (!loadData()) {
+    return boost::none;
   }
   EpwComputedField id;
   try {
@@ -3734,41 +4006,51 @@ boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& na
     LOG(Warn, "Unrecognized computed data field '" << name << "'");
     return boost::none;
   }
+  if (m_records.empty()) {
+    return boost::none;
+  }
+
+  // All computed fields are evaluated together the first time one is requested
+  if (!m_airStates) {
+    m_airStates = AirStateSeries(m_dataColumns[EpwDataField::DryBulbTemperature], m_dataColumns[EpwDataField::DewPointTemperature],
+                                 m_dataColumns[EpwDataField::RelativeHumidity], m_dataColumns[EpwDataField::AtmosphericStationPressure]);
+  }
 
   std::string units = EpwDataPoint::getUnits(id);
-  boost::optional<double> (EpwDataPoint::*compute)() const;
+  const std::vector<double>* column = nullptr;
   switch (id.value()) {
     case EpwComputedField::SaturationPressure:
-      compute = &EpwDataPoint::saturationPressure;
+      column = &m_airStates->saturationPressure();
       break;
     case EpwComputedField::Enthalpy:
-      compute = &EpwDataPoint::enthalpy;
+      column = &m_airStates->enthalpy();
       break;
     case EpwComputedField::HumidityRatio:
-      compute = &EpwDataPoint::humidityRatio;
+      column = &m_airStates->humidityRatio();
       break;
     case EpwComputedField::WetBulbTemperature:
-      compute = &EpwDataPoint::wetbulb;
+      column = &m_airStates->wetbulb();
       break;
     case EpwComputedField::Density:
-      compute = &EpwDataPoint::density;
+      column = &m_airStates->density();
       break;
     case EpwComputedField::SpecificVolume:
-      compute = &EpwDataPoint::specificVolume;
+      column = &m_airStates->specificVolume();
       break;
     default:
       return boost::none;
   }
+  // Like getTimeSeries, strip the year from typical data, whose records come from different years
+  const DateTimeVector& recordDates = recordDateTimes(!isActual());
   DateTimeVector dates;
+  dates.reserve(column->size() + 1);
   dates.push_back(DateTime());  // Use a placeholder to avoid an insert
   std::vector<double> values;
-  for (unsigned int i = 0; i < m_data.size(); i++) {
-    Date date = m_data[i].date();
-    Time time = m_data[i].time();
-    boost::optional<double> value = (m_data[i].*compute)();
-    if (value) {
-      dates.push_back(DateTime(date, time));
-      values.push_back(value.get());
+  values.reserve(column->size());
+  for (size_t i = 0; i < column->size(); ++i) {
+    if (!std::isnan((*column)[i])) {
+      dates.push_back(recordDates[i]);
+      values.push_back((*column)[i]);
     }
   }
   if (!values.empty()) {
@@ -3780,30 +4062,16 @@ boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& na
 }
 
 bool EpwFile::translateToWth(openstudio::path path, std::string description) {
-  if (m_data.empty()) {
-    if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
-      LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
-    }
-
-    // set checksum
-    m_checksum = openstudio::checksum(m_path);
-
-    // open file
-    std::ifstream ifs(openstudio::toSystemFilename(m_path));
-
-    if (!parse(ifs, true)) {
-      ifs.close();
-      LOG(Error, "EpwFile '" << toString(m_path) << "' cannot be processed");
-      return false;
-    }
-    ifs.close();
+  if (!loadData()) {
+    return false;
   }
 
   if (description.empty()) {
     description = "Translated from " + openstudio::toString(this->path());
   }
 
-  if (data().empty()) {
+  const std::vector<EpwDataPoint> records = data();
+  if (records.empty()) {
     LOG(Error, "EPW file contains no data to translate");
     return false;
   }
@@ -3830,9 +4098,9 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description) {
   }
 
   // Cheat to get data at the start time - this will need to change
-  openstudio::EpwDataPoint lastPt = data()[data().size() - 1];
+  const openstudio::EpwDataPoint& lastPt = records.back();
   std::vector<std::string> epwstrings = lastPt.toEpwStrings();
-  openstudio::DateTime dateTime = data()[0].dateTime();
+  openstudio::DateTime dateTime = records.front().dateTime();
   openstudio::Time dt = timeStep();
   dateTime -= dt;
   epwstrings[0] = std::to_string(dateTime.date().year());
@@ -3854,8 +4122,8 @@ bool EpwFile::translateToWth(openstudio::path path, std::string description) {
     return false;
   }
   fp << output.get() << '\n';
-  for (unsigned int i = 0; i < data().size(); i++) {
-    output = data()[i].toWthString();
+  for (unsigned int i = 0; i < records.size(); i++) {
+    output = records[i].toWthString();
     if (!output) {
       LOG(Error, "Translation to WTH has failed on data point " << i);
       fp.close();
@@ -3921,9 +4189,28 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
   OS_ASSERT((60 % m_recordsPerHour) == 0);
   int minutesPerRecord = 60 / m_recordsPerHour;
   int currentMinute = 0;
+  if (storeData) {
+    m_records.clear();
+    m_data.clear();
+    m_dataColumns.assign(EpwDataField::getValues().size(), std::vector<double>());
+    m_missingData.assign(m_dataColumns.size(), std::vector<bool>());
+    m_recordDateTimes.clear();
+    m_typicalRecordDateTimes.clear();
+    m_airStates.reset();
+  }
+  auto append = [this](int field, boost::optional<double> value) {
+    if (value) {
+      m_dataColumns[field].push_back(*value);
+      m_missingData[field].push_back(false);
+    } else {
+      m_dataColumns[field].push_back(std::numeric_limits<double>::quiet_NaN());
+      m_missingData[field].push_back(true);
+    }
+  };
+  std::vector<std::string> strings;
   while (std::getline(ifs, line)) {
     lineNumber++;
-    std::vector<std::string> strings = splitString(line, ',');
+    splitEpwLine(line, strings);
     if (strings.size() >= 5) {
       try {
         int year = std::stoi(strings[0]);
@@ -3972,13 +4259,31 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
               m_minutesMatch = false;
             }
           }
-          boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwStrings(year, month, day, hour, currentMinute, strings);
-          if (pt) {
-            m_data.push_back(pt.get());
-          } else {
+          // Same checks as EpwDataPoint::fromEpwStrings, so that data() can build the data points from the line later
+          if (strings.size() < 35) {
+            LOG(Error, "Expected 35 fields in EPW data instead of the " << strings.size() << " received");
+            LOG(Error, "Failed to parse line " << lineNumber << " of EPW file '" << m_path << "'");
+            return false;
+          } else if (strings.size() > 35) {
+            LOG(Warn,
+                "Expected 35 fields in EPW data instead of the " << strings.size() << " received. The additional data will be ignored");
+          }
+          if (1 > hour || 24 < hour) {
+            LOG(Error, "Hour value " << hour << " out of range");
             LOG(Error, "Failed to parse line " << lineNumber << " of EPW file '" << m_path << "'");
             return false;
           }
+          // Each weather field is parsed once, straight into its column
+          append(EpwDataField::Year, year);
+          append(EpwDataField::Month, month);
+          append(EpwDataField::Day, day);
+          append(EpwDataField::Hour, hour);
+          append(EpwDataField::Minute, currentMinute);
+          append(EpwDataField::DataSourceandUncertaintyFlags, boost::none);
+          for (int field = EpwDataField::DryBulbTemperature; field <= EpwDataField::LiquidPrecipitationQuantity; ++field) {
+            append(field, epwDataValue(field, strings[field]));
+          }
+          m_records.push_back(line);
         }
 
       } catch (...) {
@@ -89,6 +89,8 @@ class UTILITIES_API AirState
   static double R();
 
  private:
+  AirState(double drybulb, double pressure);
+
   double m_drybulb;   // Dry bulb temperature in C
   double m_dewpoint;  // Dew point temperature in C
   double m_pressure;  // Atmospheric pressure in Pa
@@ -102,6 +104,43 @@ class UTILITIES_API AirState
   double m_v;
 };
 
+/** AirStateSeries computes the moist air properties of a whole series of states at once, one pass per property over
+ *  contiguous arrays instead of one AirState per state. Each state uses the relative humidity when it is available and the
+ *  dew point temperature otherwise, as EpwDataPoint::airState does. Missing inputs are given as NaN, and properties that
+ *  cannot be computed for a state are NaN in the results. */
+class UTILITIES_API AirStateSeries
+{
+ public:
+  /** Compute the series from dry bulb temperatures in C, dew point temperatures in C, relative humidities in percent and
+   *  pressures in Pa, all of the same length */
+  AirStateSeries(const std::vector<double>& drybulb, const std::vector<double>& dewpoint, const std::vector<double>& relativeHumidity,
+                 const std::vector<double>& pressure);
+
+  /** Returns the number of states */
+  size_t size() const;
+
+  /** Returns the wet bulb temperatures in C*/
+  const std::vector<double>& wetbulb() const;
+  /** Returns the enthalpies in kJ/kg*/
+  const std::vector<double>& enthalpy() const;
+  /** Returns the saturation pressures in Pa, which only depend on the dry bulb temperature*/
+  const std::vector<double>& saturationPressure() const;
+  /** Returns the densities in kg/m3*/
+  const std::vector<double>& density() const;
+  /** Returns the specific volumes in m3/kg*/
+  const std::vector<double>& specificVolume() const;
+  /** Returns the humidity ratios */
+  const std::vector<double>& humidityRatio() const;
+
+ private:
+  std::vector<double> m_wetbulb;
+  std::vector<double> m_psat;
+  std::vector<double> m_W;
+  std::vector<double> m_h;
+  std::vector<double> m_density;
+  std::vector<double> m_v;
+};
+
 // clang-format off
 
 OPENSTUDIO_ENUM(EpwDataField,
@@ -948,6 +987,11 @@ class UTILITIES_API EpwFile
   boost::optional<TimeSeries> getTimeSeries(const std::string& field);
   /// get a time series of a computed quantity
   boost::optional<TimeSeries> getComputedTimeSeries(const std::string& field);
+  /// get the numeric values of a weather field for every record, NaN where the value is missing
+  /// the reference remains valid for the lifetime of this object, no copy of the weather data is made
+  const std::vector<double>& dataColumn(EpwDataField field);
+  /// get the missing value flags of a weather field for every record, parallel to dataColumn
+  const std::vector<bool>& missingDataMask(EpwDataField field);
 
   /// export to CONTAM WTH file
   bool translateToWth(openstudio::path path, std::string description = std::string());
@@ -969,6 +1013,8 @@ class UTILITIES_API EpwFile
   bool parseDesignConditions(const std::string& line);
   bool parseDataPeriod(const std::string& line);
   bool parseHolidaysDaylightSavings(const std::string& line);
+  bool loadData();
+  const DateTimeVector& recordDateTimes(bool stripYear);
 
   // configure logging
   REGISTER_LOGGER("openstudio.EpwFile");
@@ -990,7 +1036,17 @@ class UTILITIES_API EpwFile
   Date m_endDate;
   boost::optional<int> m_startDateActualYear;
   boost::optional<int> m_endDateActualYear;
+  // data lines as read, only turned into m_data when data() is called
+  std::vector<std::string> m_records;
   std::vector<EpwDataPoint> m_data;
+  // numeric value of each record, one column per EpwDataField, parsed when the records are read
+  std::vector<std::vector<double>> m_dataColumns;
+  std::vector<std::vector<bool>> m_missingData;
+  // record date times, built on first use with and without the year
+  DateTimeVector m_recordDateTimes;
+  DateTimeVector m_typicalRecordDateTimes;
+  // computed fields, built on first use from the columns
+  boost::optional<AirStateSeries> m_airStates;
   std::vector<EpwDesignCondition> m_designs;
 
   bool m_leapYearObserved;
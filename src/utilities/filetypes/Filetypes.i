@@ -79,6 +79,9 @@
 %ignore std::vector<openstudio::EpwFile>::vector(size_type);
 %ignore std::vector<openstudio::EpwFile>::resize(size_type);
 %template(EpwFileVector) std::vector<openstudio::EpwFile>;
+// Views on the stored weather data, use getTimeSeries instead
+%ignore openstudio::EpwFile::dataColumn;
+%ignore openstudio::EpwFile::missingDataMask;
 %template(OptionalEpwFile) boost::optional<openstudio::EpwFile>;
 
 %template(OptionalCustomOutputAdapter) boost::optional<openstudio::CustomOutputAdapter>;
@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include "../CSVFile.hpp"
+
+#include <fmt/format.h>
+
+using namespace openstudio;
+
+// A ScheduleFile-like CSV: a header row, then one row per 15 minute timestep of a year with numColumns fractional values
+static std::string scheduleCSV(int numColumns) {
+  std::string result = "Date/Time";
+  for (int j = 0; j < numColumns; ++j) {
+    result += fmt::format(",Schedule {}", j + 1);
+  }
+  result += '\n';
+
+  constexpr int numRows = 8760 * 4;
+  for (int i = 0; i < numRows; ++i) {
+    result += fmt::format("{}", i);
+    for (int j = 0; j < numColumns; ++j) {
+      result += fmt::format(",{:.4f}", static_cast<double>((i + j) % 97) / 97.0);
+    }
+    result += '\n';
+  }
+  return result;
+}
+
+static void BM_CSVFileParse(benchmark::State& state) {
+  const std::string s = scheduleCSV(state.range(0));
+  for (auto _ : state) {
+    CSVFile csvFile(s);
+    benchmark::DoNotOptimize(csvFile);
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(s.size()));
+}
+
+static void BM_CSVFileGetColumnAsDoubleVector(benchmark::State& state) {
+  // skip the header row so the columns are all numeric
+  const std::string s = scheduleCSV(state.range(0));
+  CSVFile csvFile(s.substr(s.find('\n') + 1));
+  for (auto _ : state) {
+    for (unsigned j = 1; j < csvFile.numColumns(); ++j) {
+      std::vector<double> values = csvFile.getColumnAsDoubleVector(j);
+      benchmark::DoNotOptimize(values);
+    }
+  }
+}
+
+BENCHMARK(BM_CSVFileParse)->Arg(1)->Arg(10)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CSVFileGetColumnAsDoubleVector)->Arg(1)->Arg(10)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include "../EpwFile.hpp"
+
+#include <resources.hxx>
+
+using namespace openstudio;
+
+static path epwPath() {
+  return resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+}
+
+static void BM_EpwFileLoadData(benchmark::State& state) {
+  for (auto _ : state) {
+    EpwFile epwFile(epwPath(), true);
+    benchmark::DoNotOptimize(epwFile);
+  }
+}
+
+static void BM_EpwFileGetTimeSeries(benchmark::State& state) {
+  EpwFile epwFile(epwPath(), true);
+  for (auto _ : state) {
+    boost::optional<TimeSeries> t = epwFile.getTimeSeries("Dry Bulb Temperature");
+    benchmark::DoNotOptimize(t);
+  }
+}
+
+static void BM_EpwFileDataColumn(benchmark::State& state) {
+  EpwFile epwFile(epwPath(), true);
+  for (auto _ : state) {
+    double sum = 0.0;
+    for (double value : epwFile.dataColumn(EpwDataField::DryBulbTemperature)) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+static void BM_EpwFileAirStates_PerRecord(benchmark::State& state) {
+  EpwFile epwFile(epwPath(), true);
+  std::vector<EpwDataPoint> data = epwFile.data();
+  for (auto _ : state) {
+    for (const EpwDataPoint& pt : data) {
+      boost::optional<AirState> airState = pt.airState();
+      benchmark::DoNotOptimize(airState);
+    }
+  }
+}
+
+static void BM_EpwFileAirStates_Series(benchmark::State& state) {
+  EpwFile epwFile(epwPath(), true);
+  for (auto _ : state) {
+    AirStateSeries series(epwFile.dataColumn(EpwDataField::DryBulbTemperature), epwFile.dataColumn(EpwDataField::DewPointTemperature),
+                          epwFile.dataColumn(EpwDataField::RelativeHumidity), epwFile.dataColumn(EpwDataField::AtmosphericStationPressure));
+    benchmark::DoNotOptimize(series);
+  }
+}
+
+BENCHMARK(BM_EpwFileLoadData)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EpwFileGetTimeSeries)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EpwFileDataColumn)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_EpwFileAirStates_PerRecord)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_EpwFileAirStates_Series)->Unit(benchmark::kMillisecond);
@@ -296,3 +296,106 @@ TEST(Filetypes, CSVFile_AddAndGetColumn) {
   EXPECT_EQ("2.2", getCol4[1]);
   EXPECT_EQ("0.33", getCol4[2]);
 }
+
+TEST(Filetypes, CSVFile_QuotedCells) {
+  // RFC 4180 quoting: commas, doubled quotes and line breaks inside quoted cells, CRLF line breaks
+  std::string s = "1,\"CSV, File\",\"say \"\"hi\"\"\"\r\n"
+                  "\"2\",\"multi\nline\",3.5\r\n"
+                  "a,,\n";
+  CSVFile csvFile(s);
+  ASSERT_EQ(3u, csvFile.numRows());
+  ASSERT_EQ(3u, csvFile.numColumns());
+  auto rows = csvFile.rows();
+
+  ASSERT_EQ(VariantType::Integer, rows[0][0].variantType().value());
+  EXPECT_EQ(1, rows[0][0].valueAsInteger());
+  ASSERT_EQ(VariantType::String, rows[0][1].variantType().value());
+  EXPECT_EQ("CSV, File", rows[0][1].valueAsString());
+  ASSERT_EQ(VariantType::String, rows[0][2].variantType().value());
+  EXPECT_EQ("say \"hi\"", rows[0][2].valueAsString());
+
+  // quoted numbers stay strings
+  ASSERT_EQ(VariantType::String, rows[1][0].variantType().value());
+  EXPECT_EQ("2", rows[1][0].valueAsString());
+  ASSERT_EQ(VariantType::String, rows[1][1].variantType().value());
+  EXPECT_EQ("multi\nline", rows[1][1].valueAsString());
+  ASSERT_EQ(VariantType::Double, rows[1][2].variantType().value());
+  EXPECT_EQ(3.5, rows[1][2].valueAsDouble());
+
+  EXPECT_EQ("a", rows[2][0].valueAsString());
+  EXPECT_EQ("", rows[2][1].valueAsString());
+  EXPECT_EQ("", rows[2][2].valueAsString());
+
+  // writing quotes the cells that need it, so the file reads back the same
+  CSVFile csvFile2(csvFile.string());
+  EXPECT_EQ(csvFile.string(), csvFile2.string());
+  EXPECT_EQ(rows[0][2].valueAsString(), csvFile2.rows()[0][2].valueAsString());
+  EXPECT_EQ(rows[1][1].valueAsString(), csvFile2.rows()[1][1].valueAsString());
+}
+
+TEST(Filetypes, CSVFile_NumericColumns) {
+  std::string s = "Date/Time,Value,Label\n"
+                  "2009-01-01T01:00:00,1,-\n"
+                  "2009-01-01T02:00:00,-2.5,1e\n"
+                  "2009-01-01T03:00:00,0.001,+\n"
+                  "2009-01-01T04:00:00,99999999999,.\n";
+  CSVFile csvFile(s);
+  ASSERT_EQ(5u, csvFile.numRows());
+  ASSERT_EQ(3u, csvFile.numColumns());
+
+  // header row makes the columns non numeric
+  EXPECT_TRUE(csvFile.getColumnAsDoubleVector(1).empty());
+
+  csvFile = CSVFile(s.substr(s.find('\n') + 1));
+  ASSERT_EQ(4u, csvFile.numRows());
+
+  std::vector<double> values = csvFile.getColumnAsDoubleVector(1);
+  ASSERT_EQ(4u, values.size());
+  EXPECT_EQ(1.0, values[0]);
+  EXPECT_EQ(-2.5, values[1]);
+  EXPECT_DOUBLE_EQ(0.001, values[2]);
+  EXPECT_EQ(99999999999.0, values[3]);
+
+  // integers that do not fit in an int are doubles
+  auto rows = csvFile.rows();
+  EXPECT_EQ(VariantType::Integer, rows[0][1].variantType().value());
+  EXPECT_EQ(VariantType::Double, rows[3][1].variantType().value());
+
+  // signs, dots and incomplete exponents on their own are not numbers
+  EXPECT_TRUE(csvFile.getColumnAsDoubleVector(2).empty());
+  std::vector<std::string> labels = csvFile.getColumnAsStringVector(2);
+  ASSERT_EQ(4u, labels.size());
+  EXPECT_EQ("-", labels[0]);
+  EXPECT_EQ("1e", labels[1]);
+  EXPECT_EQ("+", labels[2]);
+  EXPECT_EQ(".", labels[3]);
+
+  std::vector<DateTime> dateTimes = csvFile.getColumnAsDateTimes(0);
+  ASSERT_EQ(4u, dateTimes.size());
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1, 2009), Time(0, 4, 0, 0)), dateTimes[3]);
+}
+
+TEST(Filetypes, CSVFile_NumberFormats) {
+  // Only digits with an optional sign and fraction are numbers, as before the single-pass tokenizer
+  CSVFile csvFile(std::string("-5,+5,5.,.5,-.5,1e5,1.5E-3\n"));
+  ASSERT_EQ(1u, csvFile.numRows());
+  ASSERT_EQ(7u, csvFile.numColumns());
+  auto rows = csvFile.rows();
+
+  ASSERT_EQ(VariantType::Integer, rows[0][0].variantType().value());
+  EXPECT_EQ(-5, rows[0][0].valueAsInteger());
+  ASSERT_EQ(VariantType::Double, rows[0][1].variantType().value());
+  EXPECT_EQ(5.0, rows[0][1].valueAsDouble());
+  ASSERT_EQ(VariantType::Double, rows[0][2].variantType().value());
+  EXPECT_EQ(5.0, rows[0][2].valueAsDouble());
+
+  // no leading digit or an exponent stays a string
+  ASSERT_EQ(VariantType::String, rows[0][3].variantType().value());
+  EXPECT_EQ(".5", rows[0][3].valueAsString());
+  ASSERT_EQ(VariantType::String, rows[0][4].variantType().value());
+  EXPECT_EQ("-.5", rows[0][4].valueAsString());
+  ASSERT_EQ(VariantType::String, rows[0][5].variantType().value());
+  EXPECT_EQ("1e5", rows[0][5].valueAsString());
+  ASSERT_EQ(VariantType::String, rows[0][6].variantType().value());
+  EXPECT_EQ("1.5E-3", rows[0][6].valueAsString());
+}
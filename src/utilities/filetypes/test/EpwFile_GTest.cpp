@@ -35,6 +35,11 @@
 
 #include <resources.hxx>
 
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
 using namespace openstudio;
 
 TEST(Filetypes, EpwFile) {
@@ -575,6 +580,142 @@ TEST(Filetypes, EpwFile_NonActualTimeSeries) {
   }
 }
 
+TEST(Filetypes, EpwFile_DataColumns) {
+  path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  EpwFile epwFile(p);
+  // The columns do not need the data points
+  ASSERT_EQ(8760u, epwFile.dataColumn(EpwDataField::DryBulbTemperature).size());
+  std::vector<EpwDataPoint> data = epwFile.data();
+  ASSERT_EQ(8760u, data.size());
+
+  // Every weather field agrees with the data points, in files with and without missing values
+  for (const std::string filename :
+       {"USA_CO_Golden-NREL.724666_TMY3.epw", "CHN_Guangdong.Shaoguan.590820_CSWD.epw", "TUN_Tunis.607150_IWEC.epw"}) {
+    EpwFile other(resourcesPath() / toPath("utilities/Filetypes/" + filename));
+    std::vector<EpwDataPoint> otherData = other.data();
+    ASSERT_FALSE(otherData.empty()) << filename;
+    for (int i = EpwDataField::DryBulbTemperature; i <= EpwDataField::LiquidPrecipitationQuantity; ++i) {
+      EpwDataField field(i);
+      const std::vector<double>& column = other.dataColumn(field);
+      const std::vector<bool>& missing = other.missingDataMask(field);
+      ASSERT_EQ(otherData.size(), column.size());
+      ASSERT_EQ(otherData.size(), missing.size());
+      for (size_t j = 0; j < otherData.size(); ++j) {
+        boost::optional<double> value = otherData[j].getField(field);
+        ASSERT_EQ(!value, missing[j]) << filename << " " << field.valueName() << " record " << j;
+        if (value) {
+          EXPECT_EQ(value.get(), column[j]) << filename << " " << field.valueName() << " record " << j;
+        } else {
+          EXPECT_TRUE(std::isnan(column[j]));
+        }
+      }
+    }
+  }
+
+  // The column is a view on the stored data, not a copy
+  EXPECT_EQ(&epwFile.dataColumn(EpwDataField::WindSpeed), &epwFile.dataColumn(EpwDataField::WindSpeed));
+  EXPECT_EQ(1999, epwFile.dataColumn(EpwDataField::Year).front());
+  EXPECT_TRUE(std::isnan(epwFile.dataColumn(EpwDataField::DataSourceandUncertaintyFlags).front()));
+
+  // The time series only holds the records that have a value
+  boost::optional<TimeSeries> t = epwFile.getTimeSeries("Dry Bulb Temperature");
+  ASSERT_TRUE(t);
+  ASSERT_EQ(data.size(), t->values().size());
+  EXPECT_EQ(data[0].dryBulbTemperature().get(), t->values()[0]);
+  EXPECT_EQ(data[8759].dryBulbTemperature().get(), t->values()[8759]);
+  EXPECT_EQ(DateTime(Date(MonthOfYear::Jan, 1), Time(0, 1)), t->firstReportDateTime());
+  // The last record, Dec 31 at hour 24, is midnight of the next Jan 1, one hour after the record before it
+  int year = t->firstReportDateTime().date().year();
+  DateTime lastDateTime(Date(MonthOfYear::Jan, 1, year + 1), Time(0, 0));
+  EXPECT_EQ(lastDateTime, t->dateTimes().back());
+  EXPECT_EQ(Time(0, 1), t->dateTimes().back() - t->dateTimes()[8758]);
+  boost::optional<TimeSeries> computed = epwFile.getComputedTimeSeries("Enthalpy");
+  ASSERT_TRUE(computed);
+  EXPECT_EQ(lastDateTime, computed->dateTimes().back());
+  EXPECT_FALSE(epwFile.getTimeSeries("Year"));
+
+  // Columns are also filled when loading from a string
+  std::stringstream ss;
+  ss << std::ifstream(toSystemFilename(p)).rdbuf();
+  boost::optional<EpwFile> fromString = EpwFile::loadFromString(ss.str(), true);
+  ASSERT_TRUE(fromString);
+  EXPECT_EQ(epwFile.dataColumn(EpwDataField::GlobalHorizontalRadiation), fromString->dataColumn(EpwDataField::GlobalHorizontalRadiation));
+}
+
+TEST(Filetypes, EpwFile_AirStateSeries) {
+  constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> drybulb{20.0, -5.0, 30.0, 25.0, 25.0, 300.0, nan, 20.0};
+  std::vector<double> dewpoint{10.0, nan, 20.0, nan, 10.0, 10.0, 10.0, nan};
+  std::vector<double> relativeHumidity{nan, 60.0, 50.0, nan, 150.0, nan, 50.0, 0.0};
+  std::vector<double> pressure{101325.0, 90000.0, 101325.0, 101325.0, 101325.0, 101325.0, 101325.0, 101325.0};
+  AirStateSeries series(drybulb, dewpoint, relativeHumidity, pressure);
+  ASSERT_EQ(drybulb.size(), series.size());
+
+  for (size_t i = 0; i < series.size(); ++i) {
+    boost::optional<AirState> state;
+    if (!std::isnan(relativeHumidity[i])) {
+      state = AirState::fromDryBulbRelativeHumidityPressure(drybulb[i], relativeHumidity[i], pressure[i]);
+    } else if (!std::isnan(dewpoint[i])) {
+      state = AirState::fromDryBulbDewPointPressure(drybulb[i], dewpoint[i], pressure[i]);
+    }
+    if (state) {
+      EXPECT_NEAR(state->wetbulb(), series.wetbulb()[i], 1e-9) << i;
+      EXPECT_NEAR(state->enthalpy(), series.enthalpy()[i], 1e-9) << i;
+      EXPECT_NEAR(state->saturationPressure(), series.saturationPressure()[i], 1e-9) << i;
+      EXPECT_NEAR(state->density(), series.density()[i], 1e-12) << i;
+      EXPECT_NEAR(state->specificVolume(), series.specificVolume()[i], 1e-12) << i;
+      EXPECT_NEAR(state->humidityRatio(), series.humidityRatio()[i], 1e-12) << i;
+    } else {
+      EXPECT_TRUE(std::isnan(series.wetbulb()[i])) << i;
+      EXPECT_TRUE(std::isnan(series.enthalpy()[i])) << i;
+      EXPECT_TRUE(std::isnan(series.density()[i])) << i;
+      EXPECT_TRUE(std::isnan(series.specificVolume()[i])) << i;
+      EXPECT_TRUE(std::isnan(series.humidityRatio()[i])) << i;
+    }
+  }
+  // Indices 0 to 2 are valid states, 3 to 7 are not
+  EXPECT_FALSE(std::isnan(series.wetbulb()[2]));
+  EXPECT_TRUE(std::isnan(series.wetbulb()[3]));
+  // No dew point for dry air, so no state either
+  EXPECT_FALSE(AirState::fromDryBulbRelativeHumidityPressure(20.0, 0.0, 101325.0));
+  EXPECT_TRUE(std::isnan(series.wetbulb()[7]));
+  // The saturation pressure only needs a dry bulb in range
+  EXPECT_FALSE(std::isnan(series.saturationPressure()[3]));
+  EXPECT_FALSE(std::isnan(series.saturationPressure()[4]));
+  EXPECT_TRUE(std::isnan(series.saturationPressure()[5]));
+  EXPECT_TRUE(std::isnan(series.saturationPressure()[6]));
+
+  EXPECT_ANY_THROW(AirStateSeries(drybulb, dewpoint, relativeHumidity, std::vector<double>(2, 101325.0)));
+}
+
+TEST(Filetypes, EpwFile_ComputedTimeSeries) {
+  path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  EpwFile epwFile(p);
+  std::vector<EpwDataPoint> data = epwFile.data();
+  ASSERT_EQ(8760u, data.size());
+
+  std::vector<std::pair<std::string, boost::optional<double> (EpwDataPoint::*)() const>> fields{
+    {"Saturation Pressure", &EpwDataPoint::saturationPressure}, {"Enthalpy", &EpwDataPoint::enthalpy},
+    {"Humidity Ratio", &EpwDataPoint::humidityRatio},           {"Wet Bulb Temperature", &EpwDataPoint::wetbulb},
+    {"Density", &EpwDataPoint::density},                        {"Specific Volume", &EpwDataPoint::specificVolume}};
+  for (const auto& [name, compute] : fields) {
+    boost::optional<TimeSeries> t = epwFile.getComputedTimeSeries(name);
+    ASSERT_TRUE(t) << name;
+    Vector values = t->values();
+    size_t j = 0;
+    for (const EpwDataPoint& pt : data) {
+      boost::optional<double> value = (pt.*compute)();
+      if (value) {
+        ASSERT_LT(j, values.size()) << name;
+        EXPECT_NEAR(value.get(), values[j], 1e-9 * std::max(1.0, std::abs(value.get()))) << name;
+        ++j;
+      }
+    }
+    EXPECT_EQ(j, values.size()) << name;
+  }
+  EXPECT_FALSE(epwFile.getComputedTimeSeries("Not A Field"));
+}
+
 TEST(Filetypes, EpwFile_International_Data) {
   try {
     path p = resourcesPath() / toPath("utilities/Filetypes/CHN_Guangdong.Shaoguan.590820_CSWD.epw");
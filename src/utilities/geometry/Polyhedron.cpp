@@ -37,11 +37,105 @@
 #include <utilities/geometry/Transformation.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace openstudio {
 
+namespace {
+
+  /** Welds points that are isAlmostEqual3dPt to a single integer id. Points are hashed on a grid whose cell size is the tolerance, so any
+   *  point within tolerance of a query lies in one of the 27 cells surrounding it. When several welded points are within tolerance, the one
+   *  seen first wins, which is what a linear scan over the previously seen points would return. */
+  class VertexWelder
+  {
+   public:
+    explicit VertexWelder(size_t expectedSize, double tol = 0.0127) : m_tol(tol) {
+      m_points.reserve(expectedSize);
+      m_cells.reserve(expectedSize);
+    }
+
+    /// Returns the id of the point within tolerance of pt, adding pt as a new point if there is none
+    size_t weld(const Point3d& pt) {
+      const std::int64_t cx = cellIndex(pt.x());
+      const std::int64_t cy = cellIndex(pt.y());
+      const std::int64_t cz = cellIndex(pt.z());
+      size_t found = m_points.size();
+      for (std::int64_t dx = -1; dx <= 1; ++dx) {
+        for (std::int64_t dy = -1; dy <= 1; ++dy) {
+          for (std::int64_t dz = -1; dz <= 1; ++dz) {
+            auto it = m_cells.find(CellKey{cx + dx, cy + dy, cz + dz});
+            if (it == m_cells.end()) {
+              continue;
+            }
+            for (size_t id : it->second) {
+              if (id < found && isAlmostEqual3dPt(pt, m_points[id], m_tol)) {
+                found = id;
+              }
+            }
+          }
+        }
+      }
+      if (found == m_points.size()) {
+        m_points.push_back(pt);
+        m_cells[CellKey{cx, cy, cz}].push_back(found);
+      }
+      return found;
+    }
+
+    const std::vector<Point3d>& points() const {
+      return m_points;
+    }
+
+   private:
+    struct CellKey
+    {
+      std::int64_t x;
+      std::int64_t y;
+      std::int64_t z;
+      bool operator==(const CellKey& other) const {
+        return x == other.x && y == other.y && z == other.z;
+      }
+    };
+
+    struct CellKeyHash
+    {
+      size_t operator()(const CellKey& k) const {
+        // Large primes, as in Teschner et al. "Optimized Spatial Hashing for Collision Detection of Deformable Objects"
+        return static_cast<size_t>((static_cast<std::uint64_t>(k.x) * 73856093U) ^ (static_cast<std::uint64_t>(k.y) * 19349663U)
+                                   ^ (static_cast<std::uint64_t>(k.z) * 83492791U));
+      }
+    };
+
+    std::int64_t cellIndex(double v) const {
+      return static_cast<std::int64_t>(std::floor(v / m_tol));
+    }
+
+    double m_tol;
+    std::vector<Point3d> m_points;
+    std::unordered_map<CellKey, std::vector<size_t>, CellKeyHash> m_cells;
+  };
+
+  /// An undirected edge between two welded vertices, and the surfaces that use it
+  struct IndexedEdge
+  {
+    size_t startIndex;
+    size_t endIndex;
+    std::vector<size_t> surfNums;
+  };
+
+  std::uint64_t edgeKey(size_t v1, size_t v2) {
+    if (v1 > v2) {
+      std::swap(v1, v2);
+    }
+    return (static_cast<std::uint64_t>(v1) << 32) | static_cast<std::uint64_t>(v2);
+  }
+
+}  // namespace
+
 Surface3dEdge::Surface3dEdge(Point3d start, Point3d end, Surface3d firstSurface, size_t firstSurfNum)
   : m_start(std::move(start)), m_end(std::move(end)), m_firstSurfNum(firstSurfNum) {
   m_allSurfaces.emplace_back(std::move(firstSurface));
@@ -105,56 +199,64 @@ size_t Polyhedron::numVertices() const {
 
 std::vector<Point3d> Polyhedron::uniqueVertices() const {
 
-  std::vector<Point3d> uniqVertices;
-  uniqVertices.reserve(numVertices());
-
+  VertexWelder welder(numVertices());
   for (const auto& surface : m_surfaces) {
     for (const auto& pt : surface.vertices) {
-      if (std::find_if(uniqVertices.cbegin(), uniqVertices.cend(), [&pt](const auto& unqV) { return isAlmostEqual3dPt(pt, unqV); })
-          == uniqVertices.cend()) {
-        uniqVertices.push_back(pt);
-      }
+      welder.weld(pt);
     }
   }
-  return uniqVertices;
+  return welder.points();
 }
 
 std::vector<Surface3dEdge> Polyhedron::edgesNotTwoForEnclosedVolumeTest(const Polyhedron& volumePoly) {
 
-  std::vector<Surface3dEdge> uniqueSurface3dEdges;
-  uniqueSurface3dEdges.reserve(volumePoly.numVertices());
+  // Weld the vertices first, so that edges can be matched on a pair of integer ids instead of comparing against every edge seen so far.
+  // Edges only record the index of the surfaces that use them, the Surface3d are copied only for the edges that are returned
+  const auto numVerts = volumePoly.numVertices();
+  VertexWelder welder(numVerts);
+  std::vector<IndexedEdge> edges;
+  edges.reserve(numVerts);
+  std::unordered_map<std::uint64_t, size_t> edgeIndices;
+  edgeIndices.reserve(numVerts);
 
   // construct list of unique edges
-  int surfNum = 0;
+  size_t surfNum = 0;
+  std::vector<size_t> vertexIndices;
   for (const auto& surface : volumePoly.m_surfaces) {
     LOG(Debug, "Surface: " << surface.name);
-    const auto& vertices = surface.vertices;
-    for (auto it = vertices.begin(); it != vertices.end(); ++it) {
-      auto itnext = std::next(it);
-      if (itnext == std::end(vertices)) {
-        itnext = std::begin(vertices);
-      }
-      Surface3dEdge thisSurface3dEdge(*it, *itnext, surface, surfNum);
-      auto itFound = std::find(uniqueSurface3dEdges.begin(), uniqueSurface3dEdges.end(), thisSurface3dEdge);
-      if (itFound == uniqueSurface3dEdges.end()) {
-        LOG(Debug, "NOT FOUND: " << thisSurface3dEdge);
-        uniqueSurface3dEdges.emplace_back(std::move(thisSurface3dEdge));
+    vertexIndices.clear();
+    for (const auto& pt : surface.vertices) {
+      vertexIndices.push_back(welder.weld(pt));
+    }
+    for (size_t i = 0; i < vertexIndices.size(); ++i) {
+      const size_t startIndex = vertexIndices[i];
+      const size_t endIndex = vertexIndices[(i + 1) % vertexIndices.size()];
+      auto [it, inserted] = edgeIndices.try_emplace(edgeKey(startIndex, endIndex), edges.size());
+      if (inserted) {
+        edges.push_back(IndexedEdge{startIndex, endIndex, {surfNum}});
       } else {
-        LOG(Debug, "    FOUND: " << thisSurface3dEdge);
-        itFound->appendSurface(surface);
+        edges[it->second].surfNums.push_back(surfNum);
       }
     }
     ++surfNum;
   }
 
-  for (auto& edge : uniqueSurface3dEdges) {
-    LOG(Debug, edge);
-  }
   // All edges for an enclosed polyhedron should be shared by two (and only two) sides.
-  // So if the count is not two for all edges, the polyhedron is not enclosed, so erase all that are 2
-  uniqueSurface3dEdges.erase(
-    std::remove_if(uniqueSurface3dEdges.begin(), uniqueSurface3dEdges.end(), [](const auto& edge) { return edge.count() == 2; }),
-    uniqueSurface3dEdges.end());
+  // So if the count is not two for all edges, the polyhedron is not enclosed, so only keep those that aren't 2
+  const auto& points = welder.points();
+  std::vector<Surface3dEdge> uniqueSurface3dEdges;
+  for (const auto& edge : edges) {
+    if (edge.surfNums.size() == 2) {
+      continue;
+    }
+    Surface3dEdge surface3dEdge(points[edge.startIndex], points[edge.endIndex], volumePoly.m_surfaces[edge.surfNums.front()],
+                                edge.surfNums.front());
+    for (auto it = std::next(edge.surfNums.cbegin()); it != edge.surfNums.cend(); ++it) {
+      surface3dEdge.appendSurface(volumePoly.m_surfaces[*it]);
+    }
+    LOG(Debug, surface3dEdge);
+    uniqueSurface3dEdges.emplace_back(std::move(surface3dEdge));
+  }
 
   return uniqueSurface3dEdges;
 }
@@ -179,11 +281,22 @@ Polyhedron Polyhedron::updateZonePolygonsForMissingColinearPoints() const {
           itnext = std::begin(vertices);
         }
 
-        // Don't care about surfNum
-        Surface3dEdge thisSurface3dEdge(*it, *itnext, surface, 0);
-
-        // now go through all the vertices and see if they are colinear with start and end vertices
+        // Don't care about surfNum, and the vertices are only needed for reporting: just keep the name
+        Surface3dEdge thisSurface3dEdge(*it, *itnext, Surface3d({}, surface.name), 0);
+
+        // now go through all the vertices and see if they are colinear with start and end vertices. A point on the edge has to be within
+        // the bounding box of the edge, which is much cheaper to check than the distance to the segment
+        const double xMin = std::min(it->x(), itnext->x()) - 0.0127;
+        const double xMax = std::max(it->x(), itnext->x()) + 0.0127;
+        const double yMin = std::min(it->y(), itnext->y()) - 0.0127;
+        const double yMax = std::max(it->y(), itnext->y()) + 0.0127;
+        const double zMin = std::min(it->z(), itnext->z()) - 0.0127;
+        const double zMax = std::max(it->z(), itnext->z()) + 0.0127;
         for (const auto& testVertex : uniqVertices) {
+          if (testVertex.x() < xMin || testVertex.x() > xMax || testVertex.y() < yMin || testVertex.y() > yMax || testVertex.z() < zMin
+              || testVertex.z() > zMax) {
+            continue;
+          }
           if (thisSurface3dEdge.containsPoint(testVertex)) {
             LOG(Debug, testVertex << " is on " << thisSurface3dEdge);
             vertices.insert(itnext, testVertex);
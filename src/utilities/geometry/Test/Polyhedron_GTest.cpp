@@ -29,6 +29,7 @@
 
 #include <gtest/gtest.h>
 #include "GeometryFixture.hpp"
+#include "TiledBox.hpp"
 
 #include "../Geometry.hpp"
 #include "../Point3d.hpp"
@@ -36,6 +37,8 @@
 #include "../PointLatLon.hpp"
 #include "../Vector3d.hpp"
 
+#include <string>
+#include <tuple>
 #include <vector>
 
 using namespace openstudio;
@@ -143,3 +146,34 @@ TEST_F(GeometryFixture, Polyhedron_Titled_Roof) {
   EXPECT_DOUBLE_EQ(volume, zonePoly.calcPolyhedronVolume());
   EXPECT_DOUBLE_EQ(volume, zonePoly.calcDivergenceTheoremVolume());
 }
+
+TEST_F(GeometryFixture, Polyhedron_TiledBox) {
+
+  const int n = 10;
+  std::vector<Surface3d> surfaces = makeTiledBox(n, 0.005);
+  ASSERT_EQ(6 * n * n, surfaces.size());
+
+  {
+    Polyhedron zonePoly(surfaces);
+    // Corners are shared by three faces, edges by two
+    EXPECT_EQ(6 * (n - 1) * (n - 1) + 12 * (n - 1) + 8, zonePoly.uniqueVertices().size());
+    EXPECT_TRUE(Polyhedron::edgesNotTwoForEnclosedVolumeTest(zonePoly).empty());
+    EXPECT_TRUE(zonePoly.isEnclosedVolume().isEnclosedVolume);
+    EXPECT_NEAR(1000.0, zonePoly.calcPolyhedronVolume(), 0.5);
+  }
+
+  {
+    // Remove a tile in the middle of the first face: its four edges are now only used once
+    const std::string removedName = surfaces[n + 1].name;
+    surfaces.erase(surfaces.begin() + n + 1);
+    Polyhedron zonePoly(surfaces);
+    std::vector<Surface3dEdge> edgesNot2 = Polyhedron::edgesNotTwoForEnclosedVolumeTest(zonePoly);
+    ASSERT_EQ(4, edgesNot2.size());
+    for (const auto& edge : edgesNot2) {
+      EXPECT_EQ(1, edge.count());
+      ASSERT_EQ(1, edge.allSurfaces().size());
+      EXPECT_NE(removedName, edge.allSurfaces().front().name);
+    }
+    EXPECT_FALSE(zonePoly.isEnclosedVolume().isEnclosedVolume);
+  }
+}
@@ -34,6 +34,10 @@
 
 #include <resources.hxx>
 
+#include <json/json.h>
+
+#include <sstream>
+
 using namespace openstudio;
 
 TEST_F(GeometryFixture, ThreeJS) {
@@ -72,3 +76,30 @@ TEST_F(GeometryFixture, ThreeJS) {
   scene = ThreeScene::load(toString(p));
   ASSERT_TRUE(scene);
 }
+
+TEST_F(GeometryFixture, ThreeJS_StreamedJSON) {
+  openstudio::path p = resourcesPath() / toPath("utilities/Geometry/threejs.json");
+  boost::optional<ThreeScene> scene = ThreeScene::load(toString(p));
+  ASSERT_TRUE(scene);
+
+  // The compact output is streamed, it should match writing the whole document through jsoncpp
+  std::string json = scene->toJSON(false);
+  Json::Value root;
+  Json::CharReaderBuilder rbuilder;
+  std::istringstream ss(json);
+  std::string formattedErrors;
+  ASSERT_TRUE(Json::parseFromStream(rbuilder, ss, &root, &formattedErrors)) << formattedErrors;
+
+  Json::StreamWriterBuilder wbuilder;
+  wbuilder["commentStyle"] = "None";
+  wbuilder["indentation"] = "";
+  EXPECT_EQ(Json::writeString(wbuilder, root), json);
+
+  ASSERT_EQ(scene->geometries().size(), root["geometries"].size());
+  ASSERT_EQ(scene->object().children().size(), root["object"]["children"].size());
+
+  boost::optional<ThreeScene> roundTripped = ThreeScene::load(json);
+  ASSERT_TRUE(roundTripped);
+  EXPECT_EQ(json, roundTripped->toJSON(false));
+  EXPECT_EQ(scene->toJSON(true), roundTripped->toJSON(true));
+}
@@ -0,0 +1,72 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2023, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_TEST_TILEDBOX_HPP
+#define UTILITIES_GEOMETRY_TEST_TILEDBOX_HPP
+
+#include "../Point3d.hpp"
+#include "../Polyhedron.hpp"
+#include "../Vector3d.hpp"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+// A 10x10x10m box with each face split into n x n tiles. Each tile is shifted by +/- jitter, so neighboring tiles only share vertices
+// within tolerance
+inline std::vector<openstudio::Surface3d> makeTiledBox(int n, double jitter = 0.0) {
+  using namespace openstudio;
+  std::vector<Surface3d> surfaces;
+  const double size = 10.0;
+  const double step = size / n;
+  // origin, u, v for each face of the box
+  const std::vector<std::tuple<Point3d, Vector3d, Vector3d>> faces{
+    {{0.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {1.0, 0.0, 0.0}},  {{0.0, 0.0, size}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}},
+    {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}},  {{0.0, size, 0.0}, {0.0, 0.0, 1.0}, {1.0, 0.0, 0.0}},
+    {{0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}, {0.0, 1.0, 0.0}},  {{size, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}},
+  };
+  int faceNum = 0;
+  for (const auto& [origin, u, v] : faces) {
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        const double offset = ((i + j + faceNum) % 2 == 0) ? jitter : -jitter;
+        auto corner = [&](int di, int dj) {
+          Point3d pt = origin + ((step * (i + di)) * u) + ((step * (j + dj)) * v);
+          return Point3d(pt.x() + offset, pt.y() - offset, pt.z() + offset);
+        };
+        surfaces.emplace_back(std::vector<Point3d>{corner(0, 0), corner(1, 0), corner(1, 1), corner(0, 1)},
+                              "Face " + std::to_string(faceNum) + " Tile " + std::to_string(i) + "-" + std::to_string(j));
+      }
+    }
+    ++faceNum;
+  }
+  return surfaces;
+}
+
+#endif  // UTILITIES_GEOMETRY_TEST_TILEDBOX_HPP
@@ -582,3 +582,31 @@ TEST_F(GeometryFixture, Transformation_Decompose) {
 
   EXPECT_TRUE(transformation.matrix() == test.matrix()) << transformation.matrix() << '\n' << test.matrix();
 }
+
+TEST_F(GeometryFixture, Transformation_BulkPoints) {
+  Transformation transformation = Transformation::translation(Vector3d(10, -5, 3)) * Transformation::rotation(Vector3d(1, 1, 1), degToRad(37));
+
+  std::vector<Point3d> points{{0, 0, 0}, {1, 0, 0}, {1, 2, 0}, {-3.5, 0.25, 7}};
+  std::vector<Point3d> result = transformation * points;
+  ASSERT_EQ(points.size(), result.size());
+
+  // Reference result through the full homogeneous product
+  for (size_t i = 0; i < points.size(); ++i) {
+    Vector temp(4);
+    temp(0) = points[i].x();
+    temp(1) = points[i].y();
+    temp(2) = points[i].z();
+    temp(3) = 1.0;
+    temp = prod(transformation.matrix(), temp);
+    EXPECT_DOUBLE_EQ(temp[0], result[i].x());
+    EXPECT_DOUBLE_EQ(temp[1], result[i].y());
+    EXPECT_DOUBLE_EQ(temp[2], result[i].z());
+
+    Point3d single = transformation * points[i];
+    EXPECT_DOUBLE_EQ(result[i].x(), single.x());
+    EXPECT_DOUBLE_EQ(result[i].y(), single.y());
+    EXPECT_DOUBLE_EQ(result[i].z(), single.z());
+  }
+
+  EXPECT_TRUE((transformation * std::vector<Point3d>()).empty());
+}
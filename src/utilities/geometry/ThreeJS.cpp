@@ -38,7 +38,10 @@
 #include <json/json.h>
 
 #include <iostream>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <type_traits>
 
 namespace openstudio {
 
@@ -324,7 +327,94 @@ boost::optional<ThreeScene> ThreeScene::load(const std::string& json) {
   return boost::none;
 }
 
+namespace {
+
+  // The compact output of ThreeScene::toJSON is written piece by piece rather than by building one Json::Value for the whole
+  // scene, the geometries in particular can be very large. These write values exactly as Json::StreamWriterBuilder does
+  // without indentation, and callers write keys in sorted order like Json::Value, so the output is the same as the DOM version.
+
+  void writeJsonKey(std::ostream& os, const char* key) {
+    os << '"' << key << "\":";
+  }
+
+  void writeJsonString(std::ostream& os, const std::string& value) {
+    os << Json::valueToQuotedString(value.c_str());
+  }
+
+  void writeJsonBool(std::ostream& os, bool value) {
+    os << (value ? "true" : "false");
+  }
+
+  template <typename T>
+  void writeJsonArray(std::ostream& os, const std::vector<T>& values) {
+    os << '[';
+    bool first = true;
+    for (const auto& value : values) {
+      if (!first) {
+        os << ',';
+      }
+      first = false;
+      if constexpr (std::is_floating_point_v<T>) {
+        os << Json::valueToString(value);
+      } else {
+        os << Json::valueToString(static_cast<Json::LargestUInt>(static_cast<unsigned>(value)));
+      }
+    }
+    os << ']';
+  }
+
+}  // namespace
+
 std::string ThreeScene::toJSON(bool prettyPrint) const {
+  // write to string
+  Json::StreamWriterBuilder wbuilder;
+
+  if (prettyPrint) {
+    // mimic the old StyledWriter behavior:
+    wbuilder["commentStyle"] = "All";
+    // From source, it seems indentation was set to 3 spaces, rather than the new default of '\t'
+    wbuilder["indentation"] = "   ";
+  } else {
+    // mimic the old FastWriter behavior:
+    wbuilder["commentStyle"] = "None";
+    wbuilder["indentation"] = "";
+
+    // Stream it, keys in sorted order
+    std::unique_ptr<Json::StreamWriter> writer(wbuilder.newStreamWriter());
+    std::ostringstream os;
+
+    os << '{';
+    writeJsonKey(os, "geometries");
+    os << '[';
+    for (size_t i = 0; i < m_geometries.size(); ++i) {
+      if (i > 0) {
+        os << ',';
+      }
+      m_geometries[i].writeJson(os);
+    }
+    os << "],";
+
+    writeJsonKey(os, "materials");
+    os << '[';
+    for (size_t i = 0; i < m_materials.size(); ++i) {
+      if (i > 0) {
+        os << ',';
+      }
+      writer->write(m_materials[i].toJsonValue(), &os);
+    }
+    os << "],";
+
+    writeJsonKey(os, "metadata");
+    writer->write(m_metadata.toJsonValue(), &os);
+    os << ',';
+
+    writeJsonKey(os, "object");
+    m_sceneObject.writeJson(os, *writer);
+    os << '}';
+
+    return os.str();
+  }
+
   Json::Value scene(Json::objectValue);
 
   // metadata
@@ -347,20 +437,6 @@ std::string ThreeScene::toJSON(bool prettyPrint) const {
   // object
   scene["object"] = m_sceneObject.toJsonValue();
 
-  // write to string
-  Json::StreamWriterBuilder wbuilder;
-
-  if (prettyPrint) {
-    // mimic the old StyledWriter behavior:
-    wbuilder["commentStyle"] = "All";
-    // From source, it seems indentation was set to 3 spaces, rather than the new default of '\t'
-    wbuilder["indentation"] = "   ";
-  } else {
-    // mimic the old FastWriter behavior:
-    wbuilder["commentStyle"] = "None";
-    wbuilder["indentation"] = "";
-  }
-
   std::string result = Json::writeString(wbuilder, scene);
 
   return result;
@@ -488,6 +564,35 @@ Json::Value ThreeGeometryData::toJsonValue() const {
   return result;
 }
 
+void ThreeGeometryData::writeJson(std::ostream& os) const {
+  // normals and uvs are always written empty, see toJsonValue
+  os << '{';
+  writeJsonKey(os, "castShadow");
+  writeJsonBool(os, m_castShadow);
+  os << ',';
+  writeJsonKey(os, "doubleSided");
+  writeJsonBool(os, m_doubleSided);
+  os << ',';
+  writeJsonKey(os, "faces");
+  writeJsonArray(os, m_faces);
+  os << ',';
+  writeJsonKey(os, "normals");
+  os << "[],";
+  writeJsonKey(os, "receiveShadow");
+  writeJsonBool(os, m_receiveShadow);
+  os << ',';
+  writeJsonKey(os, "scale");
+  os << Json::valueToString(m_scale) << ',';
+  writeJsonKey(os, "uvs");
+  os << "[],";
+  writeJsonKey(os, "vertices");
+  writeJsonArray(os, m_vertices);
+  os << ',';
+  writeJsonKey(os, "visible");
+  writeJsonBool(os, m_visible);
+  os << '}';
+}
+
 std::vector<double> ThreeGeometryData::vertices() const {
   return m_vertices;
 }
@@ -544,6 +649,19 @@ Json::Value ThreeGeometry::toJsonValue() const {
   return result;
 }
 
+void ThreeGeometry::writeJson(std::ostream& os) const {
+  os << '{';
+  writeJsonKey(os, "data");
+  m_data.writeJson(os);
+  os << ',';
+  writeJsonKey(os, "type");
+  writeJsonString(os, m_type);
+  os << ',';
+  writeJsonKey(os, "uuid");
+  writeJsonString(os, m_uuid);
+  os << '}';
+}
+
 std::string ThreeGeometry::uuid() const {
   return m_uuid;
 }
@@ -1334,6 +1452,28 @@ Json::Value ThreeSceneObject::toJsonValue() const {
   return result;
 }
 
+void ThreeSceneObject::writeJson(std::ostream& os, Json::StreamWriter& writer) const {
+  os << '{';
+  writeJsonKey(os, "children");
+  os << '[';
+  for (size_t i = 0; i < m_children.size(); ++i) {
+    if (i > 0) {
+      os << ',';
+    }
+    writer.write(m_children[i].toJsonValue(), &os);
+  }
+  os << "],";
+  writeJsonKey(os, "matrix");
+  writeJsonArray(os, m_matrix);
+  os << ',';
+  writeJsonKey(os, "type");
+  writeJsonString(os, m_type);
+  os << ',';
+  writeJsonKey(os, "uuid");
+  writeJsonString(os, m_uuid);
+  os << '}';
+}
+
 std::string ThreeSceneObject::uuid() const {
   return m_uuid;
 }
@@ -39,11 +39,13 @@
 
 #include <vector>
 #include <map>
+#include <iosfwd>
 #include <boost/optional.hpp>
 
 namespace Json {
 class Value;
-}
+class StreamWriter;
+}  // namespace Json
 
 namespace openstudio {
 
@@ -121,6 +123,7 @@ class UTILITIES_API ThreeGeometryData
   friend class ThreeGeometry;
   ThreeGeometryData(const Json::Value& value);
   Json::Value toJsonValue() const;
+  void writeJson(std::ostream& os) const;
 
   std::vector<double> m_vertices;
   std::vector<size_t> m_normals;
@@ -146,6 +149,7 @@ class UTILITIES_API ThreeGeometry
   friend class ThreeScene;
   ThreeGeometry(const Json::Value& value);
   Json::Value toJsonValue() const;
+  void writeJson(std::ostream& os) const;
 
   std::string m_uuid;
   std::string m_type;
@@ -410,6 +414,7 @@ class UTILITIES_API ThreeSceneObject
   friend class ThreeScene;
   ThreeSceneObject(const Json::Value& value);
   Json::Value toJsonValue() const;
+  void writeJson(std::ostream& os, Json::StreamWriter& writer) const;
 
   std::string m_uuid;
   std::string m_type;
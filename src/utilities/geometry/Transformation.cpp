@@ -298,13 +298,13 @@ Vector3d Transformation::translation() const {
 
 /// apply the transformation to the point
 Point3d Transformation::operator*(const Point3d& point) const {
-  Vector temp(4);
-  temp(0) = point.x();
-  temp(1) = point.y();
-  temp(2) = point.z();
-  temp(3) = 1.0;
-  temp = prod(m_storage, temp);
-  return {temp[0], temp[1], temp[2]};
+  // Equivalent to prod(m_storage, [x, y, z, 1]) without allocating a temporary ublas vector, the homogeneous row is never used
+  const double x = point.x();
+  const double y = point.y();
+  const double z = point.z();
+  return {m_storage(0, 0) * x + m_storage(0, 1) * y + m_storage(0, 2) * z + m_storage(0, 3),
+          m_storage(1, 0) * x + m_storage(1, 1) * y + m_storage(1, 2) * z + m_storage(1, 3),
+          m_storage(2, 0) * x + m_storage(2, 1) * y + m_storage(2, 2) * z + m_storage(2, 3)};
 }
 
 /// apply the transformation to the vector
@@ -345,9 +345,27 @@ Plane Transformation::operator*(const Plane& plane) const {
 
 /// apply the transformation to a vector of points
 std::vector<Point3d> Transformation::operator*(const std::vector<Point3d>& points) const {
-  std::vector<Point3d> result(points.size());
-  for (unsigned i = 0; i < points.size(); ++i) {
-    result[i] = (*this) * points[i];
+  // Hoist the 3x4 affine part out of the loop so a bulk transform is a single tight pass over the points
+  const double m00 = m_storage(0, 0);
+  const double m01 = m_storage(0, 1);
+  const double m02 = m_storage(0, 2);
+  const double m03 = m_storage(0, 3);
+  const double m10 = m_storage(1, 0);
+  const double m11 = m_storage(1, 1);
+  const double m12 = m_storage(1, 2);
+  const double m13 = m_storage(1, 3);
+  const double m20 = m_storage(2, 0);
+  const double m21 = m_storage(2, 1);
+  const double m22 = m_storage(2, 2);
+  const double m23 = m_storage(2, 3);
+
+  std::vector<Point3d> result;
+  result.reserve(points.size());
+  for (const Point3d& point : points) {
+    const double x = point.x();
+    const double y = point.y();
+    const double z = point.z();
+    result.emplace_back(m00 * x + m01 * y + m02 * z + m03, m10 * x + m11 * y + m12 * z + m13, m20 * x + m21 * y + m22 * z + m23);
   }
   return result;
 }
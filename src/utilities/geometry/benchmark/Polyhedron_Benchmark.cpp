@@ -0,0 +1,35 @@
+#include <benchmark/benchmark.h>
+
+#include "../Point3d.hpp"
+#include "../Polyhedron.hpp"
+#include "../Vector3d.hpp"
+#include "../Test/TiledBox.hpp"
+
+#include <vector>
+
+using namespace openstudio;
+
+// A space with many subsurfaces or intersected surfaces looks like a box with many tiles
+static Polyhedron tiledBox(int n) {
+  return Polyhedron(makeTiledBox(n));
+}
+
+static void BM_PolyhedronUniqueVertices(benchmark::State& state) {
+  const Polyhedron zonePoly = tiledBox(state.range(0));
+  for (auto _ : state) {
+    std::vector<Point3d> uniqVertices = zonePoly.uniqueVertices();
+    benchmark::DoNotOptimize(uniqVertices);
+  }
+}
+
+static void BM_PolyhedronIsEnclosedVolume(benchmark::State& state) {
+  const Polyhedron zonePoly = tiledBox(state.range(0));
+  for (auto _ : state) {
+    VolumeEnclosedReturnType result = zonePoly.isEnclosedVolume();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 6 * state.range(0) * state.range(0));
+}
+
+BENCHMARK(BM_PolyhedronUniqueVertices)->Arg(2)->Arg(10)->Arg(30)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PolyhedronIsEnclosedVolume)->Arg(2)->Arg(10)->Arg(30)->Unit(benchmark::kMicrosecond);
@@ -504,6 +504,47 @@ TEST_F(IdfFixture, WorkspaceObject_Filter_Sources) {
   EXPECT_EQ(1, sourcesVector.size());
   sourcesVector = node->getSources(IddObjectType::OS_SetpointManager_MixedAir);
   EXPECT_EQ(1, sourcesVector.size());
+  EXPECT_TRUE(node->getSources(IddObjectType::OS_Node).empty());
+
+  // source stays until its last pointer is nullified
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName, Handle()));
+  EXPECT_EQ(1u, node->getSources(IddObjectType::OS_SetpointManager_MixedAir).size());
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::FanInletNodeName, Handle()));
+  EXPECT_TRUE(node->getSources(IddObjectType::OS_SetpointManager_MixedAir).empty());
+  EXPECT_TRUE(node->sources().empty());
+
+  // sources are rebuilt for the clone's own objects
+  Workspace clone = ws.clone();
+  std::vector<WorkspaceObject> clonedNodes = clone.getObjectsByType(IddObjectType::OS_Node);
+  ASSERT_EQ(3u, clonedNodes.size());
+  unsigned n = 0;
+  for (const WorkspaceObject& clonedNode : clonedNodes) {
+    WorkspaceObjectVector clonedSources = clonedNode.getSources(IddObjectType::OS_SetpointManager_MixedAir);
+    n += clonedSources.size();
+    for (const WorkspaceObject& clonedSource : clonedSources) {
+      EXPECT_EQ(clone, clonedSource.workspace());
+    }
+  }
+  EXPECT_EQ(2u, n);
+
+  // sources leaving from the middle of a bucket keep the others reachable
+  std::vector<WorkspaceObject> spms;
+  for (int i = 0; i < 5; ++i) {
+    OptionalWorkspaceObject other = ws.addObject(IdfObject(IddObjectType::OS_SetpointManager_MixedAir));
+    ASSERT_TRUE(other);
+    EXPECT_TRUE(other->setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName, node->handle()));
+    spms.push_back(*other);
+  }
+  EXPECT_EQ(5u, node->getSources(IddObjectType::OS_SetpointManager_MixedAir).size());
+  EXPECT_TRUE(spms[1].setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName, Handle()));
+  spms[3].remove();
+  WorkspaceObjectVector remaining = node->getSources(IddObjectType::OS_SetpointManager_MixedAir);
+  ASSERT_EQ(3u, remaining.size());
+  for (size_t i : {0, 2, 4}) {
+    EXPECT_NE(remaining.end(), std::find(remaining.begin(), remaining.end(), spms[i]));
+  }
+  EXPECT_TRUE(spms[1].setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName, node->handle()));
+  EXPECT_EQ(4u, node->getSources(IddObjectType::OS_SetpointManager_MixedAir).size());
 }
 
 TEST_F(IdfFixture, WorkspaceObject_SetDouble_NaN_and_Inf) {
@@ -589,6 +589,10 @@ namespace detail {
         ptr->initializeOnClone(oldNewHandleMap);
         this->progressValue.nano_emit(++i);
       }
+    } else {
+      for (const WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
+        ptr->indexSources();
+      }
     }
 
     // step 3: apply handle map to orderer
@@ -141,7 +141,7 @@ namespace detail {
           OptionalWorkspaceObject target = workspace().getObject(fp.targetHandle);
           if (target) {
             // need to set reverse pointer
-            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(), fp.fieldIndex);
+            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this, fp.fieldIndex);
             th = fp.targetHandle;
           }
         }
@@ -162,6 +162,7 @@ namespace detail {
       }
       m_targetData->reversePointers = mappedPointers;
     }
+    indexSources();
   }
 
   // GETTERS
@@ -296,6 +297,14 @@ namespace detail {
       return result;
     }
     if (m_targetData) {
+      if (m_targetData->sourcesIndexed) {
+        for (const auto& [type, bucket] : m_targetData->sourcesByType) {
+          for (const SourceCount& sourceCount : bucket) {
+            result.push_back(WorkspaceObject(std::static_pointer_cast<WorkspaceObject_Impl>(sourceCount.source->shared_from_this())));
+          }
+        }
+        return result;
+      }
       for (const ReversePointer& ptr : m_targetData->reversePointers) {
         OS_ASSERT(!ptr.sourceHandle.isNull());
         OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
@@ -314,6 +323,16 @@ namespace detail {
       return result;
     }
     if (m_targetData) {
+      if (m_targetData->sourcesIndexed) {
+        auto it = m_targetData->sourcesByType.find(type.value());
+        if (it != m_targetData->sourcesByType.end()) {
+          result.reserve(it->second.size());
+          for (const SourceCount& sourceCount : it->second) {
+            result.push_back(WorkspaceObject(std::static_pointer_cast<WorkspaceObject_Impl>(sourceCount.source->shared_from_this())));
+          }
+        }
+        return result;
+      }
       for (const ReversePointer& ptr : m_targetData->reversePointers) {
         OS_ASSERT(!ptr.sourceHandle.isNull());
         OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
@@ -1024,7 +1043,7 @@ namespace detail {
     OptionalWorkspaceObject oTarget = getTarget(index);
     if (oTarget) {
       WorkspaceObject target = *oTarget;
-      target.getImpl<WorkspaceObject_Impl>()->nullifyReversePointer(m_handle, index);
+      target.getImpl<WorkspaceObject_Impl>()->nullifyReversePointer(*this, index);
       // remove forwarded reference if no other source sets the same
       m_workspace->removeForwardedReferences(handle(), index, target);
     }
@@ -1038,29 +1057,92 @@ namespace detail {
     OS_ASSERT(insertResult.second);
   }
 
+  void TargetData::addSource(WorkspaceObject_Impl* source, int type) {
+    std::vector<SourceCount>& bucket = sourcesByType[type];
+    auto [positionIt, inserted] = sourcePositions.try_emplace(source, bucket.size());
+    if (inserted) {
+      bucket.push_back(SourceCount{source, 1u});
+    } else {
+      ++(bucket[positionIt->second].numPointers);
+    }
+  }
+
+  void TargetData::removeSource(const WorkspaceObject_Impl* source, int type) {
+    auto bucketIt = sourcesByType.find(type);
+    OS_ASSERT(bucketIt != sourcesByType.end());
+    auto positionIt = sourcePositions.find(source);
+    OS_ASSERT(positionIt != sourcePositions.end());
+    std::vector<SourceCount>& bucket = bucketIt->second;
+    size_t position = positionIt->second;
+    if (--(bucket[position].numPointers) == 0) {
+      sourcePositions.erase(positionIt);
+      // move the last source into the hole rather than shifting the rest of the bucket
+      if (position + 1 != bucket.size()) {
+        bucket[position] = bucket.back();
+        sourcePositions[bucket[position].source] = position;
+      }
+      bucket.pop_back();
+      if (bucket.empty()) {
+        sourcesByType.erase(bucketIt);
+      }
+    }
+  }
+
   // Pre-condition:  Object sourceHandle points to this object from field index.
   // Post-condition: That information is removed from this object's m_targetData (in preparation for
   //                 a change to the source pointer).
-  void WorkspaceObject_Impl::nullifyReversePointer(const Handle& sourceHandle, unsigned index) {
+  void WorkspaceObject_Impl::nullifyReversePointer(const WorkspaceObject_Impl& source, unsigned index) {
     OS_ASSERT(!m_handle.isNull());
     OS_ASSERT(m_targetData);
-    auto it = m_targetData->reversePointers.find(ReversePointer(sourceHandle, index));
+    auto it = m_targetData->reversePointers.find(ReversePointer(source.handle(), index));
     OS_ASSERT(it != m_targetData->reversePointers.end());
     m_targetData->reversePointers.erase(it);
+
+    if (m_targetData->sourcesIndexed) {
+      m_targetData->removeSource(&source, source.iddObject().type().value());
+    }
   }
 
-  // Pre-condition:  ReversePointer(sourceHandle,index) is not in m_targetData.
-  // Post-condition: m_targetData indicates that object sourceHandle points to this object from
+  // Pre-condition:  ReversePointer(source.handle(),index) is not in m_targetData.
+  // Post-condition: m_targetData indicates that object source points to this object from
   //                 field index.
-  void WorkspaceObject_Impl::setReversePointer(const Handle& sourceHandle, unsigned index) {
+  void WorkspaceObject_Impl::setReversePointer(const WorkspaceObject_Impl& source, unsigned index) {
     OS_ASSERT(!m_handle.isNull());
     if (!m_targetData) {
       m_targetData = TargetData();
     }
     // automatically maintains uniqueness
     std::pair<TargetData::pointer_set::iterator, bool> insertResult;
-    insertResult = m_targetData->reversePointers.insert(ReversePointer(sourceHandle, index));
+    insertResult = m_targetData->reversePointers.insert(ReversePointer(source.handle(), index));
     OS_ASSERT(insertResult.second);
+
+    if (m_targetData->sourcesIndexed) {
+      m_targetData->addSource(const_cast<WorkspaceObject_Impl*>(&source), source.iddObject().type().value());
+    }
+  }
+
+  void WorkspaceObject_Impl::indexSources() {
+    if (!m_targetData) {
+      return;
+    }
+    m_targetData->sourcesByType.clear();
+    m_targetData->sourcePositions.clear();
+    m_targetData->sourcesIndexed = false;
+    if (!m_workspace) {
+      return;
+    }
+    for (const ReversePointer& ptr : m_targetData->reversePointers) {
+      OptionalWorkspaceObject owo = m_workspace->getObject(ptr.sourceHandle);
+      if (!owo) {
+        // leave unindexed, queries fall back to looking up each reverse pointer
+        m_targetData->sourcesByType.clear();
+        m_targetData->sourcePositions.clear();
+        return;
+      }
+      WorkspaceObject_Impl* source = owo->getImpl<WorkspaceObject_Impl>().get();
+      m_targetData->addSource(source, source->iddObject().type().value());
+    }
+    m_targetData->sourcesIndexed = true;
   }
 
   void WorkspaceObject_Impl::restorePointers() {
@@ -1073,7 +1155,7 @@ namespace detail {
             WorkspaceObjectVector sources = target->getSources(iddObject().type());
             HandleVector h = getHandles<WorkspaceObject>(sources);
             if (std::find(h.begin(), h.end(), m_handle) == h.end()) {
-              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle, ptr.fieldIndex);
+              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this, ptr.fieldIndex);
             }
           }
         }
@@ -1131,7 +1213,7 @@ namespace detail {
     if (!targetHandle.isNull()) {
       OptionalWorkspaceObject target = m_workspace->getObject(targetHandle);
       OS_ASSERT(target);
-      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle, index);
+      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this, index);
       // forward references if is object-list and defines references simultaneously
       m_workspace->forwardReferences(m_handle, index, targetHandle);
     }
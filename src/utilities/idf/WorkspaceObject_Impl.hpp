@@ -36,6 +36,10 @@
 #include <utilities/idf/IdfObject_Impl.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
 
+#include <map>
+#include <unordered_map>
+#include <vector>
+
 namespace openstudio {
 
 // forward declarations
@@ -89,12 +93,46 @@ namespace detail {
   };
   using ReversePointerSet = std::set<ReversePointer, ReversePointerLess>;
 
+  class WorkspaceObject_Impl;
+
+  /** A source object and the number of its fields that point to the target. */
+  struct UTILITIES_API SourceCount
+  {
+    WorkspaceObject_Impl* source;
+    unsigned numPointers;
+  };
+
   struct UTILITIES_API TargetData
   {
     using pointer_type = ReversePointer;
     using pointer_set = ReversePointerSet;
 
     pointer_set reversePointers;
+
+    /// each distinct source appears once, in the bucket for its IddObjectType value, so that typed source queries
+    /// neither look up handles nor sort. Only meaningful if sourcesIndexed, copies of an object start unindexed.
+    std::map<int, std::vector<SourceCount>> sourcesByType;
+    /// position of each source in its bucket, so that counting a pointer in or out does not search the bucket
+    std::unordered_map<const WorkspaceObject_Impl*, size_t> sourcePositions;
+    bool sourcesIndexed = true;
+
+    TargetData() = default;
+    // the source pointers belong to the original workspace, the copy is indexed once it is in its own workspace
+    TargetData(const TargetData& other) : reversePointers(other.reversePointers), sourcesIndexed(false) {}
+    TargetData& operator=(const TargetData& other) {
+      reversePointers = other.reversePointers;
+      sourcesByType.clear();
+      sourcePositions.clear();
+      sourcesIndexed = false;
+      return *this;
+    }
+    TargetData(TargetData&& other) = default;
+    TargetData& operator=(TargetData&& other) = default;
+
+    /// counts one more pointer from source, which is of IddObjectType value type
+    void addSource(WorkspaceObject_Impl* source, int type);
+    /// counts one pointer less from source, dropping the source from its bucket when none are left
+    void removeSource(const WorkspaceObject_Impl* source, int type);
   };
   using OptionalTargetData = boost::optional<TargetData>;
 
@@ -311,9 +349,13 @@ namespace detail {
     /** Mechanics only exposed to Workspace_Impl for use in object removal. */
     void nullifyPointer(unsigned index);
 
-    void nullifyReversePointer(const Handle& sourceHandle, unsigned index);
+    void nullifyReversePointer(const WorkspaceObject_Impl& source, unsigned index);
+
+    void setReversePointer(const WorkspaceObject_Impl& source, unsigned index);
 
-    void setReversePointer(const Handle& sourceHandle, unsigned index);
+    /** Rebuilds the per-IddObjectType source buckets from the reverse pointers. Called once the object and all of its
+     *  sources are in the workspace, e.g. after cloning. */
+    void indexSources();
 
     /** Called when restoring object because could not remove and retain validity. Double-checks
      *  that companion pointers are in place. May not be able to fix all if multiple objects are
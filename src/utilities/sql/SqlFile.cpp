@@ -2279,4 +2279,21 @@ boost::optional<double> SqlFile::assemblyVisibleTransmittance(const std::string&
   return result;
 }
 
+boost::optional<double> SqlFile::componentSize(const std::string& compType, const std::string& compName, const std::string& description,
+                                               const std::string& units) const {
+  boost::optional<double> result;
+  if (m_impl) {
+    result = m_impl->componentSize(compType, compName, description, units);
+  }
+  return result;
+}
+
+boost::optional<double> SqlFile::initializationSummaryComponentSize(const std::string& compName, const std::string& description) const {
+  boost::optional<double> result;
+  if (m_impl) {
+    result = m_impl->initializationSummaryComponentSize(compName, description);
+  }
+  return result;
+}
+
 }  // namespace openstudio
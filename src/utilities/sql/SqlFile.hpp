@@ -124,6 +124,15 @@ class UTILITIES_API SqlFile
   // return an Assembly Visible Transmittance value for matching subSurfaceName (RowName)
   boost::optional<double> assemblyVisibleTransmittance(const std::string& subSurfaceName) const;
 
+  /// return the ComponentSizes value for matching compType, compName (upper case, as recorded), description and units.
+  /// The whole table is read on first use, so repeated lookups do not query the database
+  boost::optional<double> componentSize(const std::string& compType, const std::string& compName, const std::string& description,
+                                        const std::string& units) const;
+
+  /// return the 'Value' of the InitializationSummary 'Component Sizing Information' row that contains both compName (upper case, as recorded)
+  /// and description (the field description including units, eg 'Design Size Nominal Capacity [W]'). Read on first use like componentSize
+  boost::optional<double> initializationSummaryComponentSize(const std::string& compName, const std::string& description) const;
+
   /// close the file
   bool close();
 
@@ -41,6 +41,8 @@
 
 #include <sqlite3.h>
 
+#include <string_view>
+
 using boost::multi_index_container;
 using boost::multi_index::indexed_by;
 using boost::multi_index::ordered_unique;
@@ -60,6 +62,20 @@ namespace detail {
     return {reinterpret_cast<const char*>(column)};
   }
 
+  namespace {
+
+    // Joins lookup columns into a single hash key, the separator does not appear in EnergyPlus names or descriptions
+    std::string componentSizeKey(std::initializer_list<std::string_view> columns) {
+      std::string result;
+      for (const auto& column : columns) {
+        result.append(column);
+        result.push_back('\x1f');
+      }
+      return result;
+    }
+
+  }  // namespace
+
   SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes)
     : m_path(path),
       m_connectionOpen(false),
@@ -450,6 +466,12 @@ namespace detail {
       sqlite3_close(m_db);
       m_connectionOpen = false;
     }
+
+    std::lock_guard<std::mutex> lock(m_componentSizesMutex);
+    m_componentSizesLoaded = false;
+    m_componentSizes.clear();
+    m_initializationSummaryComponentSizes.clear();
+
     return true;
   }
 
@@ -534,6 +556,90 @@ namespace detail {
     return result;
   }
 
+  boost::optional<double> SqlFile_Impl::componentSize(const std::string& compType, const std::string& compName, const std::string& description,
+                                                      const std::string& units) const {
+    std::lock_guard<std::mutex> lock(m_componentSizesMutex);
+    loadComponentSizes();
+
+    auto it = m_componentSizes.find(componentSizeKey({compType, compName, description, units}));
+    if (it == m_componentSizes.end()) {
+      return boost::none;
+    }
+    return it->second;
+  }
+
+  boost::optional<double> SqlFile_Impl::initializationSummaryComponentSize(const std::string& compName, const std::string& description) const {
+    std::lock_guard<std::mutex> lock(m_componentSizesMutex);
+    loadComponentSizes();
+
+    auto it = m_initializationSummaryComponentSizes.find(componentSizeKey({compName, description}));
+    if (it == m_initializationSummaryComponentSizes.end()) {
+      return boost::none;
+    }
+    return it->second;
+  }
+
+  void SqlFile_Impl::loadComponentSizes() const {
+    if (m_componentSizesLoaded || !m_db) {
+      return;
+    }
+    m_componentSizesLoaded = true;
+
+    sqlite3_stmt* sqlStmtPtr = nullptr;
+
+    // Like the single row queries this replaces, the first entry wins when a key is repeated
+    std::string s = "SELECT CompType, CompName, Description, Units, Value FROM ComponentSizes";
+    if (sqlite3_prepare_v2(m_db, s.c_str(), -1, &sqlStmtPtr, nullptr) == SQLITE_OK) {
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        m_componentSizes.emplace(componentSizeKey({columnText(sqlite3_column_text(sqlStmtPtr, 0)), columnText(sqlite3_column_text(sqlStmtPtr, 1)),
+                                                   columnText(sqlite3_column_text(sqlStmtPtr, 2)), columnText(sqlite3_column_text(sqlStmtPtr, 3))}),
+                                 sqlite3_column_double(sqlStmtPtr, 4));
+      }
+    }
+    sqlite3_finalize(sqlStmtPtr);
+
+    // The Component Sizing table has one row per sized field, with the component type, name, field description and value in separate
+    // columns. A value is found by any two cells of its row, so every ordered pair of cells is indexed
+    struct SizingRow
+    {
+      std::vector<std::string> cells;
+      boost::optional<double> value;
+    };
+    std::vector<SizingRow> rows;
+    std::unordered_map<std::string, size_t> rowIndices;
+
+    s = R"(SELECT RowName, ColumnName, Value FROM TabularDataWithStrings
+             WHERE ReportName = 'InitializationSummary'
+             AND ReportForString = 'Entire Facility'
+             AND TableName = 'Component Sizing Information')";
+    sqlStmtPtr = nullptr;
+    if (sqlite3_prepare_v2(m_db, s.c_str(), -1, &sqlStmtPtr, nullptr) == SQLITE_OK) {
+      while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+        auto [it, inserted] = rowIndices.emplace(columnText(sqlite3_column_text(sqlStmtPtr, 0)), rows.size());
+        if (inserted) {
+          rows.emplace_back();
+        }
+        SizingRow& row = rows[it->second];
+        row.cells.push_back(columnText(sqlite3_column_text(sqlStmtPtr, 2)));
+        if (!row.value && columnText(sqlite3_column_text(sqlStmtPtr, 1)) == "Value") {
+          row.value = sqlite3_column_double(sqlStmtPtr, 2);
+        }
+      }
+    }
+    sqlite3_finalize(sqlStmtPtr);
+
+    for (const auto& row : rows) {
+      if (!row.value) {
+        continue;
+      }
+      for (const auto& first : row.cells) {
+        for (const auto& second : row.cells) {
+          m_initializationSummaryComponentSizes.emplace(componentSizeKey({first, second}), *row.value);
+        }
+      }
+    }
+  }
+
   bool SqlFile_Impl::isValidConnection() {
     std::string energyPlusVersion = this->energyPlusVersion();
     if (energyPlusVersion.empty()) {
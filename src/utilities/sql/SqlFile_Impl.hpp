@@ -45,7 +45,9 @@
 
 #include <boost/optional.hpp>
 
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 struct sqlite3;
@@ -1197,9 +1199,20 @@ namespace detail {
     // return an Assembly Visible Transmittance value for matching subSurfaceName (RowName)
     boost::optional<double> assemblyVisibleTransmittance(const std::string& subSurfaceName) const;
 
+    // return the ComponentSizes value for matching compType, compName, description and units
+    boost::optional<double> componentSize(const std::string& compType, const std::string& compName, const std::string& description,
+                                          const std::string& units) const;
+
+    // return the 'Value' of the InitializationSummary 'Component Sizing Information' row that contains both compName and description
+    boost::optional<double> initializationSummaryComponentSize(const std::string& compName, const std::string& description) const;
+
    private:
     void init();
 
+    // reads the whole ComponentSizes table, and the InitializationSummary Component Sizing table, into m_componentSizes and
+    // m_initializationSummaryComponentSizes. Must be called with m_componentSizesMutex held
+    void loadComponentSizes() const;
+
     void retrieveDataDictionary();
 
     // executes **MULTIPLE** statement and throws if it failed, used for create/drop tables.
@@ -1254,6 +1267,12 @@ namespace detail {
 
     bool m_illuminanceMapHasOnly2RefPts;
 
+    // Sizing results, loaded on first use and dropped when the connection is closed. Keys are the joined lookup columns
+    mutable std::mutex m_componentSizesMutex;
+    mutable bool m_componentSizesLoaded = false;
+    mutable std::unordered_map<std::string, double> m_componentSizes;
+    mutable std::unordered_map<std::string, double> m_initializationSummaryComponentSizes;
+
     REGISTER_LOGGER("openstudio.energyplus.SqlFile");
   };
 
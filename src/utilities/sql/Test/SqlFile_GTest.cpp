@@ -858,3 +858,77 @@ TEST_F(SqlFileFixture, 4403_FenestrationAssembly) {
   ASSERT_TRUE(sqlFile.assemblyVisibleTransmittance("Story 1 Core Space Exterior Wall Window"));
   EXPECT_EQ(0.440, sqlFile.assemblyVisibleTransmittance("Story 1 Core Space Exterior Wall Window").get());
 }
+
+TEST_F(SqlFileFixture, ComponentSizes) {
+  openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileComponentSizes.sql");
+  if (openstudio::filesystem::exists(outfile)) {
+    openstudio::filesystem::remove(outfile);
+  }
+
+  openstudio::Calendar c(2012);
+  openstudio::SqlFile sql(outfile, openstudio::EpwFile(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw")),
+                          openstudio::DateTime::now(), c);
+  ASSERT_TRUE(sql.connectionOpen());
+
+  // Stepping the statement once is enough to run an INSERT
+  auto insertComponentSize = [&sql](const std::string& compType, const std::string& compName, const std::string& description, double value,
+                                    const std::string& units) {
+    EXPECT_FALSE(sql.execAndReturnFirstInt("INSERT INTO ComponentSizes (CompType, CompName, Description, Value, Units) VALUES (?, ?, ?, ?, ?);",
+                                           compType, compName, description, value, units));
+  };
+
+  int stringIndex = 0;
+  auto insertString = [&sql, &stringIndex](const std::string& value) {
+    EXPECT_FALSE(sql.execAndReturnFirstInt("INSERT INTO Strings (StringIndex, StringTypeIndex, Value) VALUES (?, 1, ?);", ++stringIndex, value));
+    return stringIndex;
+  };
+  const int reportName = insertString("InitializationSummary");
+  const int reportFor = insertString("Entire Facility");
+  const int tableName = insertString("Component Sizing Information");
+  const int noUnits = insertString("");
+  std::map<std::string, int> rowsAndColumns;
+  auto insertCell = [&](const std::string& rowName, const std::string& columnName, const std::string& value) {
+    for (const auto& s : {rowName, columnName}) {
+      if (rowsAndColumns.find(s) == rowsAndColumns.end()) {
+        rowsAndColumns[s] = insertString(s);
+      }
+    }
+    EXPECT_FALSE(sql.execAndReturnFirstInt("INSERT INTO TabularData (ReportNameIndex, ReportForStringIndex, TableNameIndex, RowNameIndex, "
+                                           "ColumnNameIndex, UnitsIndex, Value) VALUES (?, ?, ?, ?, ?, ?, ?);",
+                                           reportName, reportFor, tableName, rowsAndColumns[rowName], rowsAndColumns[columnName], noUnits, value));
+  };
+
+  insertComponentSize("Fan:ConstantVolume", "SUPPLY FAN 1", "Design Size Maximum Flow Rate", 1.25, "m3/s");
+  insertComponentSize("Fan:ConstantVolume", "SUPPLY FAN 1", "Design Size Maximum Flow Rate", 9.99, "m3/s");
+  insertComponentSize("AirLoopHVAC", "AIR LOOP 1", "User Heating Air Flow Ratio", 0.3, "");
+
+  insertCell("1", "Component Type", "Coil:Heating:Electric");
+  insertCell("1", "Component Name", "HEATING COIL 1");
+  insertCell("1", "Input Field Description", "Design Size Nominal Capacity [W]");
+  insertCell("1", "Value", "1234.5");
+  insertCell("2", "Component Type", "Coil:Heating:Electric");
+  insertCell("2", "Component Name", "HEATING COIL 2");
+  insertCell("2", "Input Field Description", "Design Size Nominal Capacity [W]");
+  insertCell("2", "Value", "678.9");
+
+  // The first entry wins, like the single row query did
+  ASSERT_TRUE(sql.componentSize("Fan:ConstantVolume", "SUPPLY FAN 1", "Design Size Maximum Flow Rate", "m3/s"));
+  EXPECT_DOUBLE_EQ(1.25, sql.componentSize("Fan:ConstantVolume", "SUPPLY FAN 1", "Design Size Maximum Flow Rate", "m3/s").get());
+  ASSERT_TRUE(sql.componentSize("AirLoopHVAC", "AIR LOOP 1", "User Heating Air Flow Ratio", ""));
+  EXPECT_DOUBLE_EQ(0.3, sql.componentSize("AirLoopHVAC", "AIR LOOP 1", "User Heating Air Flow Ratio", "").get());
+  EXPECT_FALSE(sql.componentSize("Fan:ConstantVolume", "SUPPLY FAN 1", "Design Size Maximum Flow Rate", "cfm"));
+  EXPECT_FALSE(sql.componentSize("Fan:ConstantVolume", "Supply Fan 1", "Design Size Maximum Flow Rate", "m3/s"));
+
+  ASSERT_TRUE(sql.initializationSummaryComponentSize("HEATING COIL 2", "Design Size Nominal Capacity [W]"));
+  EXPECT_DOUBLE_EQ(678.9, sql.initializationSummaryComponentSize("HEATING COIL 2", "Design Size Nominal Capacity [W]").get());
+  ASSERT_TRUE(sql.initializationSummaryComponentSize("HEATING COIL 1", "Design Size Nominal Capacity [W]"));
+  EXPECT_DOUBLE_EQ(1234.5, sql.initializationSummaryComponentSize("HEATING COIL 1", "Design Size Nominal Capacity [W]").get());
+  EXPECT_FALSE(sql.initializationSummaryComponentSize("HEATING COIL 3", "Design Size Nominal Capacity [W]"));
+
+  // Results are read once, reopening the file reads them again
+  insertComponentSize("Fan:ConstantVolume", "SUPPLY FAN 2", "Design Size Maximum Flow Rate", 2.5, "m3/s");
+  EXPECT_FALSE(sql.componentSize("Fan:ConstantVolume", "SUPPLY FAN 2", "Design Size Maximum Flow Rate", "m3/s"));
+  EXPECT_TRUE(sql.reopen());
+  ASSERT_TRUE(sql.componentSize("Fan:ConstantVolume", "SUPPLY FAN 2", "Design Size Maximum Flow Rate", "m3/s"));
+  EXPECT_DOUBLE_EQ(2.5, sql.componentSize("Fan:ConstantVolume", "SUPPLY FAN 2", "Design Size Maximum Flow Rate", "m3/s").get());
+}
@@ -468,28 +468,84 @@ boost::optional<Quantity> QuantityConverterSingleton::m_convertToTargetFromSI(co
   return converted;
 }
 
-boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits) {
+// All conversions are linear in the value, so converting 0 gives the offset and converting a second value gives the
+// factor. The second value is a power of two so that the division is exact, and large so that the factor of conversions
+// with an offset (temperatures) does not lose precision in the subtraction. Returns the plan along with the units of the
+// converted quantities.
+template <typename ConvertFunction>
+static boost::optional<std::pair<UnitConversionPlan, Unit>> probeConversionPlan(const Unit& originalUnits, const ConvertFunction& convertQuantity) {
+  constexpr double probeValue = 1024.0;
+  Quantity testQuantity(0.0, originalUnits);
+  OptionalQuantity offset = convertQuantity(testQuantity);
+  if (!offset) {
+    return boost::none;
+  }
+  testQuantity.setValue(probeValue);
+  OptionalQuantity probe = convertQuantity(testQuantity);
+  OS_ASSERT(probe);
+  OS_ASSERT(offset->units() == probe->units());
+  return std::make_pair(UnitConversionPlan{(probe->value() - offset->value()) / probeValue, offset->value()}, offset->units());
+}
+
+static std::vector<double> applyConversionPlan(const UnitConversionPlan& plan, const std::vector<double>& values) {
+  std::vector<double> result(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    result[i] = plan.apply(values[i]);
+  }
+  return result;
+}
+
+boost::optional<UnitConversionPlan> QuantityConverterSingleton::conversionPlan(const std::string& originalUnits, const std::string& finalUnits) const {
+  {
+    std::shared_lock l{m_conversionPlansMutex};
+    auto it = m_conversionPlans.find(originalUnits);
+    if (it != m_conversionPlans.end()) {
+      auto planIt = it->second.find(finalUnits);
+      if (planIt != it->second.end()) {
+        return planIt->second;
+      }
+    }
+  }
+
   if (originalUnits == finalUnits) {
-    return original;
+    return UnitConversionPlan{1.0, 0.0};
   }
 
-  //create the units from the strings
+  // create the units from the strings, failures are not cached as units may be registered later
   boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
   boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
+  if (!originalUnit || !finalUnit) {
+    return boost::none;
+  }
+  auto probe = probeConversionPlan(*originalUnit, [this, &finalUnit](const Quantity& q) { return convert(q, *finalUnit); });
+  if (!probe) {
+    return boost::none;
+  }
 
-  //make sure both unit strings were valid
-  if (originalUnit && finalUnit) {
+  std::unique_lock l{m_conversionPlansMutex};
+  m_conversionPlans[originalUnits].emplace(finalUnits, probe->first);
+  return probe->first;
+}
 
-    //make the original quantity
-    Quantity originalQuant = Quantity(original, *originalUnit);
+boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits) {
+  if (originalUnits == finalUnits) {
+    return original;
+  }
+
+  if (boost::optional<UnitConversionPlan> plan = QuantityConverter::instance().conversionPlan(originalUnits, finalUnits)) {
+    return plan->apply(original);
+  }
 
-    //convert to final units
-    boost::optional<Quantity> finalQuant = QuantityConverter::instance().convert(originalQuant, *finalUnit);
+  return boost::none;
+}
 
-    //if the conversion
-    if (finalQuant) {
-      return finalQuant->value();
-    }
+boost::optional<std::vector<double>> convert(const std::vector<double>& original, const std::string& originalUnits, const std::string& finalUnits) {
+  if (originalUnits == finalUnits) {
+    return original;
+  }
+
+  if (boost::optional<UnitConversionPlan> plan = QuantityConverter::instance().conversionPlan(originalUnits, finalUnits)) {
+    return applyConversionPlan(*plan, original);
   }
 
   return boost::none;
@@ -500,19 +556,11 @@ boost::optional<Quantity> convert(const Quantity& original, UnitSystem sys) {
 }
 
 OSQuantityVector convert(const OSQuantityVector& original, UnitSystem sys) {
-  OSQuantityVector result;
-  Quantity testQuantity(0.0, original.units());
-  OptionalQuantity offset = convert(testQuantity, sys);
-  if (!offset) {
-    return result;
-  }
-  testQuantity.setValue(1.0);
-  OptionalQuantity factorPlusOffset = convert(testQuantity, sys);
-  OS_ASSERT(factorPlusOffset);
-  OS_ASSERT(offset->units() == factorPlusOffset->units());
-  result = OSQuantityVector(offset->units(), original.values());
-  result = result * (factorPlusOffset->value() - offset->value()) + offset.get();
-  return result;
+  auto probe = probeConversionPlan(original.units(), [sys](const Quantity& q) { return convert(q, sys); });
+  if (!probe) {
+    return {};
+  }
+  return {probe->second, applyConversionPlan(probe->first, original.values())};
 }
 
 boost::optional<Quantity> convert(const Quantity& original, const Unit& targetUnits) {
@@ -520,19 +568,11 @@ boost::optional<Quantity> convert(const Quantity& original, const Unit& targetUn
 }
 
 OSQuantityVector convert(const OSQuantityVector& original, const Unit& targetUnits) {
-  OSQuantityVector result;
-  Quantity testQuantity(0.0, original.units());
-  OptionalQuantity offset = convert(testQuantity, targetUnits);
-  if (!offset) {
-    return result;
-  }
-  testQuantity.setValue(1.0);
-  OptionalQuantity factorPlusOffset = convert(testQuantity, targetUnits);
-  OS_ASSERT(factorPlusOffset);
-  OS_ASSERT(offset->units() == factorPlusOffset->units());
-  result = OSQuantityVector(offset->units(), original.values());
-  result = result * (factorPlusOffset->value() - offset->value()) + offset.get();
-  return result;
+  auto probe = probeConversionPlan(original.units(), [&targetUnits](const Quantity& q) { return convert(q, targetUnits); });
+  if (!probe) {
+    return {};
+  }
+  return {probe->second, applyConversionPlan(probe->first, original.values())};
 }
 
 }  // namespace openstudio
@@ -37,6 +37,8 @@
 #include "Unit.hpp"
 #include <string>
 #include <map>
+#include <shared_mutex>
+#include <vector>
 
 namespace openstudio {
 
@@ -88,6 +90,18 @@ struct baseUnitConversionFactor
   double offset;
 };
 
+/** Every conversion between two units is linear in the value, finalValue = factor * originalValue + offset. A
+ *  UnitConversionPlan stores factor and offset so that repeated conversions do not need to go through Quantity. */
+struct UnitConversionPlan
+{
+  double factor;
+  double offset;
+
+  double apply(double value) const {
+    return factor * value + offset;
+  }
+};
+
 /** Singleton for converting quantities to different \link UnitSystem unit systems \endlink or
  *  to targeted \link Unit units \endlink */
 class UTILITIES_API QuantityConverterSingleton
@@ -100,6 +114,11 @@ class UTILITIES_API QuantityConverterSingleton
 
   boost::optional<Quantity> convert(const Quantity& original, const Unit& targetUnits) const;
 
+  /** Returns the plan to convert values from originalUnits to finalUnits, or boost::none if the unit strings cannot be
+   *  parsed or converted. Plans are cached by unit strings, so only the first request for a pair parses the units. Thread
+   *  safe. */
+  boost::optional<UnitConversionPlan> conversionPlan(const std::string& originalUnits, const std::string& finalUnits) const;
+
  private:
   REGISTER_LOGGER("openstudio.units.QuantityConverter");
   QuantityConverterSingleton();
@@ -115,6 +134,11 @@ class UTILITIES_API QuantityConverterSingleton
   Quantity m_convertFromSI(const Quantity& original, const UnitSystem& targetSys) const;
 
   boost::optional<Quantity> m_convertToTargetFromSI(const Quantity& original, const Unit& targetUnits) const;
+
+  // conversion plans by original then final unit string, heterogeneous lookup avoids building a key per call
+  using ConversionPlanMap = std::map<std::string, std::map<std::string, UnitConversionPlan, std::less<>>, std::less<>>;
+  mutable ConversionPlanMap m_conversionPlans;
+  mutable std::shared_mutex m_conversionPlansMutex;
 };
 
 /** \relates QuantityConverterSingleton */
@@ -123,18 +147,23 @@ using QuantityConverter = openstudio::Singleton<QuantityConverterSingleton>;
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits);
 
+/** Non-member function that converts an entire vector of values with a single conversion plan.
+ *  \relates QuantityConverterSingleton */
+UTILITIES_API boost::optional<std::vector<double>> convert(const std::vector<double>& original, const std::string& originalUnits,
+                                                           const std::string& finalUnits);
+
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<Quantity> convert(const Quantity& original, UnitSystem sys);
 
-/** Non-member function that uses just two calls to QuantityConverter to convert an entire
- *  OSQuantityVector. \relates QuantityConverterSingleton \relates OSQuantityVector */
+/** Non-member function that converts an entire OSQuantityVector with a single conversion plan.
+ *  \relates QuantityConverterSingleton \relates OSQuantityVector */
 UTILITIES_API OSQuantityVector convert(const OSQuantityVector& original, UnitSystem sys);
 
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<Quantity> convert(const Quantity& original, const Unit& targetUnits);
 
-/** Non-member function that uses just two calls to QuantityConverter to convert an entire
- *  OSQuantityVector. \relates QuantityConverterSingleton \relates OSQuantityVector */
+/** Non-member function that converts an entire OSQuantityVector with a single conversion plan.
+ *  \relates QuantityConverterSingleton \relates OSQuantityVector */
 UTILITIES_API OSQuantityVector convert(const OSQuantityVector& original, const Unit& targetUnits);
 
 }  // namespace openstudio
@@ -255,6 +255,45 @@ TEST_F(UnitsFixture, QuantityConverter_OSQuantityVector) {
   EXPECT_TRUE(resultQ->isRelative());
 }
 
+TEST_F(UnitsFixture, QuantityConverter_ConversionPlan) {
+  // Plans give the same values as the conversion through Quantity
+  std::vector<std::pair<std::string, std::string>> unitPairs{
+    {"m", "ft"}, {"kW", "Btu/h"}, {"W/m^2", "W/ft^2"}, {"m^3/s", "ft^3/min"}, {"C", "F"}, {"F", "K"}, {"kBtu", "GJ"}};
+  for (const auto& [originalUnits, finalUnits] : unitPairs) {
+    boost::optional<UnitConversionPlan> plan = QuantityConverter::instance().conversionPlan(originalUnits, finalUnits);
+    ASSERT_TRUE(plan) << originalUnits << " to " << finalUnits;
+    Unit originalUnit = createUnit(originalUnits).get();
+    Unit finalUnit = createUnit(finalUnits).get();
+    for (double value : {-40.0, 0.0, 0.5, 21.0, 1.0e6}) {
+      OptionalQuantity expected = QuantityConverter::instance().convert(Quantity(value, originalUnit), finalUnit);
+      ASSERT_TRUE(expected);
+      EXPECT_NEAR(expected->value(), plan->apply(value), 1.0E-12 * std::max(1.0, std::abs(expected->value())))
+        << value << " " << originalUnits << " to " << finalUnits;
+      boost::optional<double> converted = convert(value, originalUnits, finalUnits);
+      ASSERT_TRUE(converted);
+      EXPECT_EQ(plan->apply(value), converted.get());
+    }
+  }
+
+  EXPECT_DOUBLE_EQ(68.0, convert(20.0, "C", "F").get());
+  EXPECT_DOUBLE_EQ(1.0, QuantityConverter::instance().conversionPlan("m", "m")->factor);
+  EXPECT_FALSE(QuantityConverter::instance().conversionPlan("m", "s"));
+  EXPECT_FALSE(QuantityConverter::instance().conversionPlan("m", "not a unit"));
+  EXPECT_FALSE(convert(1.0, "m", "s"));
+
+  // Vector overload
+  std::vector<double> values{0.0, 10.0, 100.0};
+  boost::optional<std::vector<double>> converted = convert(values, "C", "F");
+  ASSERT_TRUE(converted);
+  ASSERT_EQ(3u, converted->size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(convert(values[i], "C", "F").get(), (*converted)[i]);
+  }
+  EXPECT_DOUBLE_EQ(212.0, converted->back());
+  EXPECT_EQ(values, convert(values, "m", "m").get());
+  EXPECT_FALSE(convert(values, "m", "s"));
+}
+
 TEST_F(UnitsFixture, QuantityConverter_Profiling_QuantityVectorBaseCase) {
   QuantityVector result(testQuantityVector);
   for (auto& elem : result) {
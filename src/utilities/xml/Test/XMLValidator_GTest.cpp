@@ -36,6 +36,7 @@
 #include <algorithm>
 #include <iostream>
 #include <boost/regex.hpp>
+#include <pugixml.hpp>
 #include <resources.hxx>
 #include <stdexcept>
 
@@ -221,3 +222,35 @@ INSTANTIATE_TEST_SUITE_P(XMLValidatorFixture, GbXMLValidatorParametrizedFixture,
                              filename.begin(), filename.end(), [](char c) { return !std::isalnum(c); }, '_');
                            return filename;
                          });
+
+TEST_F(XMLValidatorFixture, XMLValidator_GBXMLvalidator_InMemory) {
+  openstudio::path xmlPath = resourcesPath() / openstudio::toPath("gbxml/TestCube.xml");
+
+  auto xmlValidator = XMLValidator::gbxmlValidator();
+  EXPECT_EQ(openstudio::toPath(":/xml/resources/GreenBuildingXML_Ver6.01.xsd"), xmlValidator.schemaPath());
+  EXPECT_FALSE(xmlValidator.validate(xmlPath));
+  const auto fileErrors = xmlValidator.errors();
+  EXPECT_EQ(8, fileErrors.size());
+
+  openstudio::filesystem::ifstream file(xmlPath, std::ios_base::binary);
+  ASSERT_TRUE(file.is_open());
+  std::string xmlString((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  // A second validator shares the compiled schema, and reports the same thing for the in-memory document
+  auto xmlValidator2 = XMLValidator::gbxmlValidator();
+  EXPECT_FALSE(xmlValidator2.validateString(xmlString));
+  EXPECT_FALSE(xmlValidator2.isValid());
+  EXPECT_FALSE(xmlValidator2.xmlPath());
+  EXPECT_EQ(0, xmlValidator2.warnings().size());
+  EXPECT_EQ(fileErrors.size(), xmlValidator2.errors().size());
+
+  pugi::xml_document doc;
+  ASSERT_TRUE(doc.load_string(xmlString.c_str()));
+  EXPECT_FALSE(xmlValidator2.validate(doc));
+  EXPECT_FALSE(xmlValidator2.xmlPath());
+  EXPECT_EQ(fileErrors.size(), xmlValidator2.errors().size());
+
+  EXPECT_FALSE(xmlValidator2.validateString("<gbXML>"));
+  EXPECT_FALSE(xmlValidator2.isValid());
+  EXPECT_FALSE(xmlValidator2.errors().empty());
+}
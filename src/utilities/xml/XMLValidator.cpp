@@ -52,39 +52,163 @@
 #include <src/utilities/embedded_files.hxx>
 
 #include <fmt/format.h>
+#include <pugixml.hpp>
 
 #include <algorithm>
+#include <functional>
 #include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
 
 namespace openstudio {
 
+namespace {
+
+  // A compiled XSD schema or XSLT stylesheet. Once built these are read-only, and both libxml2 and libxslt allow sharing them between
+  // validation / transformation contexts, including from several threads
+  struct CompiledSchema
+  {
+    std::shared_ptr<xmlSchema> schema;
+    // Messages emitted while parsing the XSD, replayed on each validation as if the schema had been parsed again
+    std::vector<LogMessage> parserMessages;
+    std::shared_ptr<xsltStylesheet> stylesheet;
+  };
+
+  // Process-wide cache of compiled schemas, keyed by embedded resource path or absolute file path.
+  // The cache is only ever constructed after the XMLInitializer singleton, so it is destroyed (and the schemas freed) before libxml2
+  // is cleaned up
+  class CompiledSchemaCache
+  {
+   public:
+    static CompiledSchemaCache& instance() {
+      static CompiledSchemaCache cache;
+      return cache;
+    }
+
+    // stamp identifies the version of a file on disk, a changed stamp triggers a recompilation
+    std::shared_ptr<const CompiledSchema> get(const std::string& key, const std::string& stamp,
+                                              const std::function<CompiledSchema()>& compile) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_entries.find(key);
+      if ((it != m_entries.end()) && (it->second.stamp == stamp)) {
+        return it->second.compiled;
+      }
+      auto compiled = std::make_shared<const CompiledSchema>(compile());
+      m_entries[key] = Entry{stamp, compiled};
+      return compiled;
+    }
+
+    void erase(const std::string& key) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_entries.erase(key);
+    }
+
+   private:
+    struct Entry
+    {
+      std::string stamp;
+      std::shared_ptr<const CompiledSchema> compiled;
+    };
+
+    std::mutex m_mutex;
+    std::map<std::string, Entry> m_entries;
+  };
+
+  std::string fileStamp(const openstudio::path& p) {
+    boost::system::error_code ec;
+    const auto lastWriteTime = openstudio::filesystem::last_write_time(p, ec);
+    const auto fileSize = openstudio::filesystem::file_size(p, ec);
+    return fmt::format("{}:{}", lastWriteTime, fileSize);
+  }
+
+  CompiledSchema compileXSD(xmlSchemaParserCtxt* parser_ctxt) {
+    CompiledSchema result;
+
+    detail::ErrorCollector schemaParserErrorCollector;
+    xmlSchemaSetParserErrors(parser_ctxt, detail::callback_messages_error, detail::callback_messages_warning, &schemaParserErrorCollector);
+
+    result.schema.reset(xmlSchemaParse(parser_ctxt), xmlSchemaFree);
+    result.parserMessages = std::move(schemaParserErrorCollector.logMessages);
+
+    xmlSchemaFreeParserCtxt(parser_ctxt);
+    return result;
+  }
+
+  std::shared_ptr<const CompiledSchema> compiledXSD(const openstudio::path& schemaPath, bool isEmbedded) {
+    const auto key = openstudio::toString(schemaPath);
+    if (isEmbedded) {
+      return CompiledSchemaCache::instance().get(key, "", [&key]() {
+        const std::string xsdString = ::openstudio::embedded_files::getFileAsString(key);
+        return compileXSD(xmlSchemaNewMemParserCtxt(xsdString.data(), detail::checked_int_cast(xsdString.size())));
+      });
+    }
+    return CompiledSchemaCache::instance().get(key, fileStamp(schemaPath),
+                                               [&key]() { return compileXSD(xmlSchemaNewParserCtxt(key.c_str())); });
+  }
+
+  std::shared_ptr<const CompiledSchema> compiledEmbeddedStylesheet(const std::string& embedded_path) {
+    return CompiledSchemaCache::instance().get(embedded_path, "", [&embedded_path]() {
+      const std::string xlstString = ::openstudio::embedded_files::getFileAsString(embedded_path);
+      xmlDoc* xlstDoc = xmlParseMemory(xlstString.data(), detail::checked_int_cast(xlstString.size()));
+      CompiledSchema result;
+      // xlstDoc is owned by the stylesheet when xsltParseStylesheetDoc succeeds, and freed via xsltFreeStylesheet
+      result.stylesheet.reset(xsltParseStylesheetDoc(xlstDoc), xsltFreeStylesheet);
+      return result;
+    });
+  }
+
+  std::shared_ptr<const CompiledSchema> compiledStylesheet(const openstudio::path& stylesheetPath) {
+    const auto key = openstudio::toString(stylesheetPath);
+    return CompiledSchemaCache::instance().get(key, fileStamp(stylesheetPath), [&key]() {
+      CompiledSchema result;
+      result.stylesheet.reset(xsltParseStylesheetFile(detail::xml_string(key)), xsltFreeStylesheet);
+      return result;
+    });
+  }
+
+  // Parses the in-memory document if xmlString isn't null, otherwise the file at xmlPath
+  xmlDoc* parseXMLDocument(const boost::optional<openstudio::path>& xmlPath, const std::string* xmlString) {
+    if (xmlString != nullptr) {
+      // Same behavior as the defaults set by the XMLInitializer, which xmlParseFile picks up
+      constexpr int options = XML_PARSE_NOENT | XML_PARSE_DTDLOAD | XML_PARSE_NOBLANKS;
+      return xmlReadMemory(xmlString->data(), detail::checked_int_cast(xmlString->size()), nullptr, nullptr, options);
+    }
+    auto xml_filename_str = toString(xmlPath.get());
+    return xmlParseFile(xml_filename_str.c_str());
+  }
+
+}  // namespace
+
 xmlDoc* applyEmbeddedXSLT(const std::string& embedded_path, xmlDoc* curdoc, const char** params) {
 
-  std::string xlstString = ::openstudio::embedded_files::getFileAsString(embedded_path);
-  xmlDoc* xlstDoc = xmlParseDoc(detail::xml_string(xlstString));
-  xsltStylesheet* style = xsltParseStylesheetDoc(xlstDoc);
-  xmlDoc* res = xsltApplyStylesheet(style, curdoc, params);
+  const auto compiled = compiledEmbeddedStylesheet(embedded_path);
+  xmlDoc* res = xsltApplyStylesheet(compiled->stylesheet.get(), curdoc, params);
 
-  xsltFreeStylesheet(style);
-  // xmlFreeDoc(xlstDoc); // This is already freed via xlstFreeStyleSheet because we used xsltParseStylesheetDoc
   xmlFreeDoc(curdoc);
   return res;
 }
 
 xmlDoc* applyEmbeddedXSLTWithImports(xmlDoc* curdoc, const openstudio::path& outputDir, const char** params) {
 
-  // Extract the two files we need
-  bool quiet = true;
+  // iso_svrl_for_xslt1.xsl uses an xsl:import, so it is compiled from disk once, then kept in the cache under its embedded name
+  const auto compiled = CompiledSchemaCache::instance().get(":/xml/resources/iso_svrl_for_xslt1.xsl", "", [&outputDir]() {
+    // Extract the two files we need
+    bool quiet = true;
 
-  ::openstudio::embedded_files::extractFile(":/xml/resources/iso_svrl_for_xslt1.xsl", openstudio::toString(outputDir), quiet);
-  ::openstudio::embedded_files::extractFile(":/xml/resources/iso_schematron_skeleton_for_xslt1.xsl", openstudio::toString(outputDir), quiet);
+    ::openstudio::embedded_files::extractFile(":/xml/resources/iso_svrl_for_xslt1.xsl", openstudio::toString(outputDir), quiet);
+    ::openstudio::embedded_files::extractFile(":/xml/resources/iso_schematron_skeleton_for_xslt1.xsl", openstudio::toString(outputDir),
+                                              quiet);
 
-  auto schematron_filename_str = openstudio::toString(outputDir / "iso_svrl_for_xslt1.xsl");
-  xsltStylesheet* style = xsltParseStylesheetFile(detail::xml_string(schematron_filename_str));
+    auto schematron_filename_str = openstudio::toString(outputDir / "iso_svrl_for_xslt1.xsl");
+    CompiledSchema result;
+    result.stylesheet.reset(xsltParseStylesheetFile(detail::xml_string(schematron_filename_str)), xsltFreeStylesheet);
+    return result;
+  });
 
-  xmlDoc* res = xsltApplyStylesheet(style, curdoc, params);
+  xmlDoc* res = xsltApplyStylesheet(compiled->stylesheet.get(), curdoc, params);
 
-  xsltFreeStylesheet(style);
   xmlFreeDoc(curdoc);
 
   return res;
@@ -213,8 +337,22 @@ XMLValidator::XMLValidator(const openstudio::path& schemaPath) : m_schemaPath(op
   }
 }
 
+XMLValidator::XMLValidator(const std::string& embeddedSchemaPath, XMLValidatorType validatorType)
+  : m_schemaPath(openstudio::toPath(embeddedSchemaPath)), m_isEmbeddedSchema(true), m_validatorType(validatorType) {
+
+  xmlInitializerInstance();
+
+  if (!::openstudio::embedded_files::hasFile(embeddedSchemaPath)) {
+    std::string logMessage = fmt::format("Embedded schema '{}' does not exist", embeddedSchemaPath);
+    m_logMessages.emplace_back(Fatal, "openstudio.XMLValidator", logMessage);
+    LOG_AND_THROW(logMessage);
+  }
+}
+
 XMLValidator::~XMLValidator() {
   if (m_tempDir) {
+    // The converted stylesheet is specific to this instance, no point in keeping it compiled
+    CompiledSchemaCache::instance().erase(toString(m_schemaPath));
     try {
       const auto count = openstudio::filesystem::remove_all(m_tempDir.get());
       logAndStore(Debug, fmt::format("Removed temporary directory with {} files", count));
@@ -256,7 +394,7 @@ std::vector<LogMessage> XMLValidator::warnings() const {
 }
 
 bool XMLValidator::isValid() const {
-  if (!m_xmlPath) {
+  if (!m_hasValidated) {
     logAndStore(Warn, fmt::format("Nothing has yet been validated against '{}'", toString(m_schemaPath)));
     return false;
   }
@@ -268,6 +406,7 @@ void XMLValidator::reset() {
   m_logMessages.clear();
 
   m_xmlPath = boost::none;
+  m_hasValidated = false;
 
   m_fullValidationReport.clear();
 }
@@ -295,35 +434,43 @@ bool XMLValidator::validate(const openstudio::path& xmlPath) {
     LOG_AND_THROW(logMessage);
   }
 
+  return validateImpl(nullptr);
+}
+
+bool XMLValidator::validate(const pugi::xml_document& doc) {
+  // Same indentation as the gbXML ForwardTranslator uses when saving, so line numbers in the messages match the file it writes
+  std::ostringstream ss;
+  doc.save(ss, "  ");
+  return validateString(ss.str());
+}
+
+bool XMLValidator::validateString(const std::string& xmlString) {
+
+  reset();
+
+  return validateImpl(&xmlString);
+}
+
+bool XMLValidator::validateImpl(const std::string* xmlString) {
+
+  m_hasValidated = true;
+
   if (m_validatorType == XMLValidatorType::XSD) {
-    return xsdValidate();
+    return xsdValidate(xmlString);
   } else if ((m_validatorType == XMLValidatorType::XSLTSchematron) || (m_validatorType == XMLValidatorType::Schematron)) {
-    return xsltValidate();
+    return xsltValidate(xmlString);
   }
 
   return false;
 }
 
-bool XMLValidator::xsdValidate() const {
+bool XMLValidator::xsdValidate(const std::string* xmlString) const {
 
-  // schema path
-  auto schema_filename_str = toString(m_schemaPath);
-  const auto* schema_filename = schema_filename_str.c_str();
+  const std::string xmlDescription = m_xmlPath ? toString(m_xmlPath.get()) : std::string("in-memory document");
 
-  // xml path
-  auto xml_filename_str = toString(m_xmlPath.get());
-  const auto* xml_filename = xml_filename_str.c_str();
-
-  // schema parser ptr
-  xmlSchemaParserCtxt* parser_ctxt = xmlSchemaNewParserCtxt(schema_filename);
-
-  // set parser errors
-  detail::ErrorCollector schemaParserErrorCollector;
-  xmlSchemaSetParserErrors(parser_ctxt, detail::callback_messages_error, detail::callback_messages_warning, &schemaParserErrorCollector);
-
-  // schema parser
-  xmlSchema* schema = xmlSchemaParse(parser_ctxt);
-  xmlSchemaValidCtxt* ctxt = xmlSchemaNewValidCtxt(schema);
+  // compiled schema, shared by all validators using the same schema
+  const auto compiled = compiledXSD(m_schemaPath, m_isEmbeddedSchema);
+  xmlSchemaValidCtxt* ctxt = xmlSchemaNewValidCtxt(compiled->schema.get());
 
   // set valid errors
   detail::ErrorCollector schemaValidErrorCollector;
@@ -334,7 +481,7 @@ bool XMLValidator::xsdValidate() const {
   xmlSetGenericErrorFunc(&parseFileErrorCollector, detail::callback_messages_error);
 
   // xml doc ptr
-  xmlDoc* doc = xmlParseFile(xml_filename);
+  xmlDoc* doc = parseXMLDocument(m_xmlPath, xmlString);
 
   // validate doc
   int ret = xmlSchemaValidateDoc(ctxt, doc);
@@ -344,20 +491,20 @@ bool XMLValidator::xsdValidate() const {
     result = false;
   } else if (ret < 0) {
     logAndStore(Fatal,
-                fmt::format("Valid instance '{}' got internal error validating against '{}'", toString(m_xmlPath.get()), toString(m_schemaPath)));
+                fmt::format("Valid instance '{}' got internal error validating against '{}'", xmlDescription, toString(m_schemaPath)));
     result = false;
   } else {
     result = true;
   }
 
-  m_logMessages.reserve(m_logMessages.size() + schemaValidErrorCollector.logMessages.size() + schemaParserErrorCollector.logMessages.size()
+  m_logMessages.reserve(m_logMessages.size() + schemaValidErrorCollector.logMessages.size() + compiled->parserMessages.size()
                         + parseFileErrorCollector.logMessages.size());
 
   for (auto& logMessage : schemaValidErrorCollector.logMessages) {
     logAndStore(logMessage.logLevel(), "xsdValidate.schemaValidError: " + logMessage.logMessage());
   }
 
-  for (auto& logMessage : schemaParserErrorCollector.logMessages) {
+  for (const auto& logMessage : compiled->parserMessages) {
     logAndStore(logMessage.logLevel(), "xsdValidate.schemaParserError: " + logMessage.logMessage());
   }
 
@@ -366,9 +513,7 @@ bool XMLValidator::xsdValidate() const {
   }
 
   // free
-  xmlSchemaFreeParserCtxt(parser_ctxt);
   xmlSchemaFreeValidCtxt(ctxt);
-  xmlSchemaFree(schema);
 
   xmlFreeDoc(doc);
 
@@ -449,17 +594,15 @@ std::string dumpXSLTApplyResultToString(xmlDoc* res, xsltStylesheet* style) {
   return result;
 }
 
-bool XMLValidator::xsltValidate() const {
+bool XMLValidator::xsltValidate(const std::string* xmlString) const {
 
   xmlSubstituteEntitiesDefault(1);
   xmlLoadExtDtdDefaultValue = 1;
 
-  auto schematron_filename_str = openstudio::toString(m_schemaPath);
-  xsltStylesheet* style = xsltParseStylesheetFile(detail::xml_string(schematron_filename_str));
+  const auto compiled = m_isEmbeddedSchema ? compiledEmbeddedStylesheet(toString(m_schemaPath)) : compiledStylesheet(m_schemaPath);
+  xsltStylesheet* style = compiled->stylesheet.get();
 
-  auto filename_str = openstudio::toString(m_xmlPath.get());
-  const auto* filename = filename_str.c_str();
-  xmlDoc* doc = xmlParseFile(filename);
+  xmlDoc* doc = parseXMLDocument(m_xmlPath, xmlString);
   xmlDoc* res = xsltApplyStylesheet(style, doc, nullptr);
 
   // Dump result of xlstApply
@@ -475,7 +618,6 @@ bool XMLValidator::xsltValidate() const {
   /* dump the resulting document */
   // xmlDocDump(stdout, res);
 
-  xsltFreeStylesheet(style);
   xmlFreeDoc(res);
   xmlFreeDoc(doc);
 
@@ -496,22 +638,11 @@ std::vector<LogMessage> XMLValidator::logMessages() const {
 }
 
 XMLValidator XMLValidator::gbxmlValidator() {
-  const auto tmpDir = openstudio::filesystem::create_temporary_directory("xmlvalidation");
-  if (tmpDir.empty()) {
-    LOG_AND_THROW("Failed to create a temporary directory for extracting the embedded path");
-  }
-  const bool quiet = true;
-  ::openstudio::embedded_files::extractFile(":/xml/resources/GreenBuildingXML_Ver6.01.xsd", openstudio::toString(tmpDir), quiet);
-  return XMLValidator(tmpDir / "GreenBuildingXML_Ver6.01.xsd");
+  return {":/xml/resources/GreenBuildingXML_Ver6.01.xsd", XMLValidatorType::XSD};
 }
 
 XMLValidator XMLValidator::bclXMLValidator(openstudio::BCLXMLType bclXMLType, const VersionString& schemaVersion) {
 
-  const auto tmpDir = openstudio::filesystem::create_temporary_directory("xmlvalidation");
-  if (tmpDir.empty()) {
-    LOG_AND_THROW("Failed to create a temporary directory for extracting the embedded path");
-  }
-
   int schemaVersionMajor = schemaVersion.major();
   int schemaVersionMinor = schemaVersion.minor();
 
@@ -532,9 +663,7 @@ XMLValidator XMLValidator::bclXMLValidator(openstudio::BCLXMLType bclXMLType, co
   }
   schemaName = fmt::format("{}_v{}.{}.xsd", schemaName, schemaVersionMajor, schemaVersionMinor);
 
-  const bool quiet = true;
-  ::openstudio::embedded_files::extractFile(fmt::format(":/xml/resources/bcl/{}", schemaName), openstudio::toString(tmpDir), quiet);
-  return XMLValidator(tmpDir / schemaName);
+  return {fmt::format(":/xml/resources/bcl/{}", schemaName), XMLValidatorType::XSD};
 }
 
 }  // namespace openstudio
@@ -44,6 +44,10 @@
 
 #include <string>
 
+namespace pugi {
+class xml_document;
+}  // namespace pugi
+
 namespace openstudio {
 
 enum class XMLValidatorType
@@ -76,8 +80,11 @@ class UTILITIES_API XMLValidator
   XMLValidator& operator=(const XMLValidator& other) = default;
   XMLValidator& operator=(XMLValidator&& other) noexcept = default;
 
+  /** Validator for the embedded gbXML schema. The compiled schema is loaded from memory and shared by all instances,
+   *  schemaPath() then returns the embedded resource path (eg ':/xml/resources/GreenBuildingXML_Ver6.01.xsd') */
   static XMLValidator gbxmlValidator();
 
+  /** Validator for the embedded BCL measure.xml or component.xml schema, same caching as gbxmlValidator */
   static XMLValidator bclXMLValidator(openstudio::BCLXMLType bclXMLType = openstudio::BCLXMLType::MeasureXML,
                                       const VersionString& schemaVersion = VersionString(3, 1));
 
@@ -89,6 +96,12 @@ class UTILITIES_API XMLValidator
 
   bool validate(const openstudio::path& xmlPath);
 
+  /** Validate a document without writing it to disk first. xmlPath() will be empty afterwards */
+  bool validate(const pugi::xml_document& doc);
+
+  /** Validate an XML document held in memory. xmlPath() will be empty afterwards */
+  bool validateString(const std::string& xmlString);
+
   // Below functions are related to the last call to validate
 
   bool isValid() const;
@@ -123,16 +136,24 @@ class UTILITIES_API XMLValidator
   // LOG the message (to console) and store it in m_logMessages
   void logAndStore(LogLevel logLevel, const std::string& logMessage) const;
 
+  // Used for the built-in validators, the schemaPath is then the embedded resource path
+  XMLValidator(const std::string& embeddedSchemaPath, XMLValidatorType validatorType);
+
   openstudio::path m_schemaPath;
+  bool m_isEmbeddedSchema = false;
   boost::optional<openstudio::path> m_xmlPath;
+  bool m_hasValidated = false;
 
   boost::optional<openstudio::path> m_tempDir;
 
   XMLValidatorType m_validatorType;
 
-  bool xsdValidate() const;
+  // Checks the validator type and dispatches to xsdValidate or xsltValidate. If xmlString is null, m_xmlPath is parsed instead
+  bool validateImpl(const std::string* xmlString);
+
+  bool xsdValidate(const std::string* xmlString) const;
 
-  bool xsltValidate() const;
+  bool xsltValidate(const std::string* xmlString) const;
   mutable std::string m_fullValidationReport;
 
   // reset the state of the XMLValidator between translations
@@ -11,6 +11,9 @@
 // ignore detail namespace
 %ignore openstudio::detail;
 
+// pugi isn't wrapped, use validateString instead
+%ignore openstudio::XMLValidator::validate(const pugi::xml_document&);
+
 %include <utilities/xml/XMLValidator.hpp>
 
 #endif
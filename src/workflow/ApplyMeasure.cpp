@@ -109,20 +109,21 @@ void OSWorkflow::applyMeasures(MeasureType measureType, bool energyplus_output_r
       if (!measurePtr) {
         throw std::runtime_error(fmt::format("Could not load measure at '{}'", openstudio::toString(scriptPath_.get())));
       }
-      // Initialize arguments which may be model dependent, don't allow arguments method access to real model in case it changes something
+      // Initialize arguments which may be model dependent, don't allow arguments method access to real model in case it changes something.
+      // The clone is reused across steps for as long as neither the real model nor the clone changed
       std::vector<measure::OSArgument> arguments;
 
       LOG(Debug, "measure->name()= '" << measurePtr->name() << "'");
 
       if (measureType == MeasureType::ModelMeasure) {
         // For computing arguments
-        auto modelClone = model.clone(true).cast<model::Model>();
+        auto modelClone = modelArgumentsClone.get(model).cast<model::Model>();
         arguments = static_cast<openstudio::measure::ModelMeasure*>(measurePtr)->arguments(modelClone);  // NOLINT
       } else if (measureType == MeasureType::EnergyPlusMeasure) {
-        auto workspaceClone = workspace_->clone(true).cast<openstudio::Workspace>();
+        auto workspaceClone = workspaceArgumentsClone.get(workspace_.get());
         arguments = static_cast<openstudio::measure::EnergyPlusMeasure*>(measurePtr)->arguments(workspaceClone);  // NOLINT
       } else if (measureType == MeasureType::ReportingMeasure) {
-        auto modelClone = model.clone(true).cast<model::Model>();
+        auto modelClone = modelArgumentsClone.get(model).cast<model::Model>();
         arguments = static_cast<openstudio::measure::ReportingMeasure*>(measurePtr)->arguments(modelClone);  // NOLINT
       }
 
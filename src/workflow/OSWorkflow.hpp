@@ -2,6 +2,7 @@
 #define WORKFLOW_OSWORKFLOW_HPP
 
 #include "Timer.hpp"
+#include "Util.hpp"
 
 #include "../measure/OSRunner.hpp"
 #include "../scriptengine/ScriptEngine.hpp"
@@ -45,6 +46,9 @@ class OSWorkflow
   measure::OSRunner runner{workflowJSON};
   model::Model model;
   boost::optional<Workspace> workspace_;
+  // Clones handed to measure arguments methods, shared between steps until something changes
+  workflow::util::ArgumentsClone modelArgumentsClone;
+  workflow::util::ArgumentsClone workspaceArgumentsClone;
   openstudio::filesystem::path epwPath;
   openstudio::filesystem::path sqlPath;
 
@@ -26,6 +26,7 @@
 #include <boost/process.hpp>
 #include <boost/regex.hpp>
 
+#include <chrono>
 #include <cstdlib>
 #include <stdexcept>
 
@@ -190,13 +191,28 @@ void OSWorkflow::runEnergyPlus() {
     const std::string cmd = fmt::format("\"{}\" {}", openstudio::toString(runDirResults.energyPlusExe.native()), inIDF.filename().string());
     LOG(Info, "Running command '" << cmd << "'");
 
+    // Tail the eplusout.err while EnergyPlus runs, so severe and fatal errors are reported as soon as they happen instead of after a long
+    // annual run. EnergyPlus exits by itself after a fatal error, and killing it would cut the error summary, so we only report here
+    const auto errPath = runDirPath / "eplusout.err";
+    if (openstudio::filesystem::exists(errPath)) {
+      // Don't pick up the one from a previous run before EnergyPlus truncates it
+      openstudio::filesystem::remove(errPath);
+    }
+    openstudio::energyplus::ErrorFile errFile(errPath, [](openstudio::energyplus::ErrorLevel level, const std::string& message) {
+      if (level == openstudio::energyplus::ErrorLevel::Fatal) {
+        LOG(Error, "EnergyPlus Fatal Error: " << message);
+      } else {
+        LOG(Warn, "EnergyPlus Severe Error: " << message);
+      }
+    });
+
     // boost::process allows redirecting stdout / stderr easily, but I can no longer debug in LLDB, which is annoying
     // Edit: actually std::system has the same issue... it captures a SIGVTALRM
     // Disable with: `pro hand -p true -s false SIGVTALRM`
     int result = 0;
 
     if constexpr (useBoostProcess) {
-      detailedTimeBlock("Running EnergyPlus", [this, /*&cmd,*/ &result, &runDirPath, &runDirResults, &inIDF] {
+      detailedTimeBlock("Running EnergyPlus", [this, /*&cmd,*/ &result, &runDirPath, &runDirResults, &inIDF, &errFile] {
         // result = std::system(cmd.c_str());
         namespace bp = boost::process;
         bp::ipstream is;
@@ -206,11 +222,18 @@ void OSWorkflow::runEnergyPlus() {
         std::string line;
         // bp::child c(cmd, bp::std_out > is);
         bp::child c(runDirResults.energyPlusExe, inIDF.filename(), bp::std_out > is);
+        auto lastErrCheck = std::chrono::steady_clock::now();
         while (c.running() && std::getline(is, line)) {
           stdout_ofs << line;
           if (m_show_stdout) {
             fmt::print("{}\n", line);
           }
+          // No need to look at eplusout.err for every line EnergyPlus prints
+          const auto now = std::chrono::steady_clock::now();
+          if (now - lastErrCheck > std::chrono::seconds(1)) {
+            lastErrCheck = now;
+            errFile.update();
+          }
         }
         c.wait();
         result = c.exit_code();
@@ -225,7 +248,6 @@ void OSWorkflow::runEnergyPlus() {
     }
 
     {
-      auto errPath = runDirPath / "eplusout.err";
       if (openstudio::filesystem::is_regular_file(errPath)) {
 
         const auto errContent = openstudio::filesystem::read_as_string(errPath);
@@ -238,7 +260,8 @@ void OSWorkflow::runEnergyPlus() {
         // TODO: or we use ErrorFile... In which case what's the point of parsing the number of warnings/severe from eplusout.end?
         // Actually, ErrorFile doesn't understand recurring warnings
         // TODO: add a channel filter on the logger to avoid catching all the debug statements in the ErrorFile class
-        const openstudio::energyplus::ErrorFile errFile(errPath);
+        errFile.update();
+        errFile.finish();
         std::string status = errFile.completedSuccessfully() ? "Completed Successfully" : "Failed";
         fmt::print("EnergyPlus {} with ", status);
         fmt::print(fmt::fg(fmt::color::red), "{} Fatal Errors, ", errFile.fatalErrors().size());
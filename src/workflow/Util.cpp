@@ -1,6 +1,7 @@
 #include "Util.hpp"
 
 #include "../model/Model.hpp"
+#include "../model/Model_Impl.hpp"
 #include "../osversion/VersionTranslator.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Filesystem.hpp"
@@ -9,10 +10,12 @@
 #include "../utilities/core/ZipFile.hpp"
 #include "../utilities/bcl/BCLXML.hpp"
 #include "../utilities/idf/Workspace.hpp"
+#include "../utilities/idf/Workspace_Impl.hpp"
 #include "../utilities/idf/IdfFile.hpp"
 #include "../utilities/idf/IdfObject.hpp"
 #include "../utilities/idd/IddObject.hpp"
 #include "../utilities/idf/IdfExtensibleGroup.hpp"
+#include "../utilities/sql/SqlFile.hpp"
 
 #include <boost/filesystem/operations.hpp>
 #include <utilities/idd/IddEnums.hxx>
@@ -298,4 +301,40 @@ void zipResults(const openstudio::path& dirPath) {
   }
 }
 
+Workspace ArgumentsClone::get(const Workspace& source) {
+  auto sourceImpl = source.getImpl<openstudio::detail::Workspace_Impl>();
+  if (m_source.lock() != sourceImpl) {
+    if (auto previousSource = m_source.lock()) {
+      previousSource->onChange.disconnect<ArgumentsClone, &ArgumentsClone::markStale>(this);
+    }
+    sourceImpl->onChange.connect<ArgumentsClone, &ArgumentsClone::markStale>(this);
+    m_source = sourceImpl;
+    m_stale = true;
+  }
+
+  if (m_stale || !m_clone) {
+    if (m_clone) {
+      m_clone->getImpl<openstudio::detail::Workspace_Impl>()->onChange.disconnect<ArgumentsClone, &ArgumentsClone::markStale>(this);
+    }
+    m_clone = source.clone(true);
+    m_clone->getImpl<openstudio::detail::Workspace_Impl>()->onChange.connect<ArgumentsClone, &ArgumentsClone::markStale>(this);
+    m_stale = false;
+  } else if (auto sourceModel = source.optionalCast<model::Model>()) {
+    // clone() also copies the model's workflow and sql file, setting those doesn't fire onChange so bring them over again
+    auto modelClone = m_clone->cast<model::Model>();
+    modelClone.setWorkflowJSON(sourceModel->workflowJSON());
+    if (auto sqlFile = sourceModel->sqlFile()) {
+      modelClone.setSqlFile(*sqlFile);
+    } else {
+      modelClone.resetSqlFile();
+    }
+  }
+
+  return m_clone.get();
+}
+
+void ArgumentsClone::markStale() {
+  m_stale = true;
+}
+
 }  // namespace openstudio::workflow::util
@@ -2,6 +2,13 @@
 #define WORKFLOW_UTIL_HPP
 
 #include "../utilities/core/Filesystem.hpp"
+#include "../utilities/idf/Workspace.hpp"
+
+#include <nano/nano_signal_slot.hpp>  // Signal-Slot replacement
+
+#include <boost/optional.hpp>
+
+#include <memory>
 
 namespace openstudio {
 
@@ -9,7 +16,9 @@ namespace model {
   class Model;
 }
 class IdfObject;
-class Workspace;
+namespace detail {
+  class Workspace_Impl;
+}
 
 namespace workflow {
 
@@ -28,6 +37,24 @@ namespace workflow {
 
     void zipResults(const openstudio::path& dirPath);
 
+    /** Hands out a clone of a Workspace (or Model) for measure arguments methods, which must not get access to the real one. The clone is
+     *  reused for consecutive measures and only rebuilt once the source or the clone itself has changed, so a deep copy is paid only after a
+     *  step actually modified something (or an arguments method wrote to the clone). The workflow and sql file of a Model are not
+     *  watched, they are copied over from the source each time a clone is reused. */
+    class ArgumentsClone : public Nano::Observer
+    {
+     public:
+      Workspace get(const Workspace& source);
+
+      // public slots:
+      void markStale();
+
+     private:
+      std::weak_ptr<openstudio::detail::Workspace_Impl> m_source;
+      boost::optional<Workspace> m_clone;
+      bool m_stale = true;
+    };
+
   }  // namespace util
 }  // namespace workflow
 }  // namespace openstudio
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include "../Util.hpp"
+
+#include "../../model/Model.hpp"
+#include "../../model/Model_Impl.hpp"
+#include "../../model/Space.hpp"
+#include "../../model/Space_Impl.hpp"
+#include "../../utilities/filetypes/WorkflowJSON.hpp"
+#include "../../utilities/idf/Workspace_Impl.hpp"
+
+using namespace openstudio;
+
+namespace {
+
+bool isSameClone(const Workspace& clone1, const Workspace& clone2) {
+  return clone1.getImpl<detail::Workspace_Impl>() == clone2.getImpl<detail::Workspace_Impl>();
+}
+
+}  // namespace
+
+TEST(ArgumentsClone, Reuse) {
+  model::Model model;
+  model::Space space(model);
+
+  workflow::util::ArgumentsClone argumentsClone;
+  Workspace clone1 = argumentsClone.get(model);
+  EXPECT_FALSE(isSameClone(model, clone1));
+  EXPECT_TRUE(clone1.getObject(space.handle()));
+
+  // Nothing changed, the same clone is handed out again
+  Workspace clone2 = argumentsClone.get(model);
+  EXPECT_TRUE(isSameClone(clone1, clone2));
+}
+
+TEST(ArgumentsClone, SourceChanged) {
+  model::Model model;
+
+  workflow::util::ArgumentsClone argumentsClone;
+  Workspace clone1 = argumentsClone.get(model);
+  EXPECT_EQ(0, clone1.cast<model::Model>().getConcreteModelObjects<model::Space>().size());
+
+  // A step modified the real model, the next arguments method must see it
+  model::Space space(model);
+  Workspace clone2 = argumentsClone.get(model);
+  EXPECT_FALSE(isSameClone(clone1, clone2));
+  EXPECT_TRUE(clone2.getObject(space.handle()));
+
+  // So must a model that replaced the previous one
+  model::Model otherModel;
+  Workspace clone3 = argumentsClone.get(otherModel);
+  EXPECT_FALSE(isSameClone(clone2, clone3));
+  EXPECT_FALSE(clone3.getObject(space.handle()));
+}
+
+TEST(ArgumentsClone, CloneChanged) {
+  model::Model model;
+
+  workflow::util::ArgumentsClone argumentsClone;
+  Workspace clone1 = argumentsClone.get(model);
+
+  // An arguments method wrote to its clone, the next one gets a fresh copy of the real model
+  model::Space space(clone1.cast<model::Model>());
+  Workspace clone2 = argumentsClone.get(model);
+  EXPECT_FALSE(isSameClone(clone1, clone2));
+  EXPECT_FALSE(clone2.getObject(space.handle()));
+  EXPECT_EQ(0, clone2.cast<model::Model>().getConcreteModelObjects<model::Space>().size());
+}
+
+TEST(ArgumentsClone, ModelWorkflowJSON) {
+  model::Model model;
+
+  workflow::util::ArgumentsClone argumentsClone;
+  Workspace clone1 = argumentsClone.get(model);
+  EXPECT_FALSE(clone1.cast<model::Model>().workflowJSON().seedFile());
+
+  // Setting the workflow doesn't change any object, the reused clone still has to carry it
+  WorkflowJSON workflowJSON;
+  EXPECT_TRUE(workflowJSON.setSeedFile(toPath("seed.osm")));
+  model.setWorkflowJSON(workflowJSON);
+
+  Workspace clone2 = argumentsClone.get(model);
+  EXPECT_TRUE(isSameClone(clone1, clone2));
+  ASSERT_TRUE(clone2.cast<model::Model>().workflowJSON().seedFile());
+  EXPECT_EQ(toPath("seed.osm"), clone2.cast<model::Model>().workflowJSON().seedFile().get());
+}